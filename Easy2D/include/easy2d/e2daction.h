@@ -1,16 +1,174 @@
 #pragma once
 #include <easy2d/e2dcommon.h>
 #include <easy2d/e2dbase.h>
+#include <easy2d/e2dmanager.h>
 
 namespace easy2d
 {
 
 
 class Node;
+class Sprite;
 class Loop;
 class Sequence;
 class Spawn;
 class ActionManager;
+class TweenManager;
+class TweenGroup;
+
+
+// 
+// Ϊ [0, 1] ʱȣΪȣ f(0) = 0, f(1) = 1
+class Ease
+{
+public:
+	// 
+	enum class Type : int
+	{
+		Linear,			/*  */
+		QuadIn,			/* η */
+		QuadOut,		/* η */
+		QuadInOut,		/* η뻺 */
+		CubicIn,		/* η */
+		CubicOut,		/* η */
+		CubicInOut,		/* η뻺 */
+		SineIn,			/* һ */
+		SineOut,		/* һ */
+		SineInOut,		/* һ뻺 */
+		BackIn,			/* ˻ */
+		BackOut,		/* ˻ */
+		BackInOut,		/* ˻뻺 */
+		ElasticIn,		/* Ի */
+		ElasticOut,		/* Ի */
+		ElasticInOut,	/* Ի뻺 */
+		BounceIn,		/*  */
+		BounceOut,		/*  */
+		BounceInOut,	/* 뻺 */
+		Custom			/* Զ建 */
+	};
+
+	// Զ建
+	using Func = Function<float(float)>;
+
+public:
+	static inline float linear(float t) { return t; }
+
+	static inline float quadIn(float t) { return t * t; }
+
+	static inline float quadOut(float t) { return t * (2 - t); }
+
+	static inline float quadInOut(float t) { return t < 0.5f ? 2 * t * t : -1 + (4 - 2 * t) * t; }
+
+	static inline float cubicIn(float t) { return t * t * t; }
+
+	static inline float cubicOut(float t) { t -= 1; return t * t * t + 1; }
+
+	static inline float cubicInOut(float t) { return t < 0.5f ? 4 * t * t * t : (t - 1) * (2 * t - 2) * (2 * t - 2) + 1; }
+
+	static inline float sineIn(float t) { return 1 - ::cosf(t * math::constants::PI_F_2); }
+
+	static inline float sineOut(float t) { return ::sinf(t * math::constants::PI_F_2); }
+
+	static inline float sineInOut(float t) { return (1 - ::cosf(t * math::constants::PI_F)) / 2; }
+
+	static inline float backIn(float t) { return t * t * (2.70158f * t - 1.70158f); }
+
+	static inline float backOut(float t) { t -= 1; return t * t * (2.70158f * t + 1.70158f) + 1; }
+
+	static inline float backInOut(float t)
+	{
+		const float s = 2.5949095f;
+		return t < 0.5f
+			? (2 * t) * (2 * t) * ((s + 1) * 2 * t - s) / 2
+			: ((2 * t - 2) * (2 * t - 2) * ((s + 1) * (t * 2 - 2) + s) + 2) / 2;
+	}
+
+	static inline float elasticIn(float t)
+	{
+		if (t <= 0 || t >= 1) return t;
+		return -::powf(2, 10 * t - 10) * ::sinf((t * 10 - 10.75f) * math::constants::PI_F_X_2 / 3);
+	}
+
+	static inline float elasticOut(float t)
+	{
+		if (t <= 0 || t >= 1) return t;
+		return ::powf(2, -10 * t) * ::sinf((t * 10 - 0.75f) * math::constants::PI_F_X_2 / 3) + 1;
+	}
+
+	static inline float elasticInOut(float t)
+	{
+		if (t <= 0 || t >= 1) return t;
+		const float s = ::sinf((20 * t - 11.125f) * math::constants::PI_F_X_2 / 4.5f);
+		return t < 0.5f
+			? -(::powf(2, 20 * t - 10) * s) / 2
+			: (::powf(2, -20 * t + 10) * s) / 2 + 1;
+	}
+
+	static inline float bounceOut(float t)
+	{
+		if (t < 1 / 2.75f) return 7.5625f * t * t;
+		if (t < 2 / 2.75f) { t -= 1.5f / 2.75f; return 7.5625f * t * t + 0.75f; }
+		if (t < 2.5f / 2.75f) { t -= 2.25f / 2.75f; return 7.5625f * t * t + 0.9375f; }
+		t -= 2.625f / 2.75f;
+		return 7.5625f * t * t + 0.984375f;
+	}
+
+	static inline float bounceIn(float t) { return 1 - bounceOut(1 - t); }
+
+	static inline float bounceInOut(float t) { return t < 0.5f ? (1 - bounceOut(1 - 2 * t)) / 2 : (1 + bounceOut(2 * t - 1)) / 2; }
+
+	// 㻺ֵ
+	static inline float apply(Type type, float t)
+	{
+		switch (type)
+		{
+		case Type::QuadIn:			return quadIn(t);
+		case Type::QuadOut:			return quadOut(t);
+		case Type::QuadInOut:		return quadInOut(t);
+		case Type::CubicIn:			return cubicIn(t);
+		case Type::CubicOut:		return cubicOut(t);
+		case Type::CubicInOut:		return cubicInOut(t);
+		case Type::SineIn:			return sineIn(t);
+		case Type::SineOut:			return sineOut(t);
+		case Type::SineInOut:		return sineInOut(t);
+		case Type::BackIn:			return backIn(t);
+		case Type::BackOut:			return backOut(t);
+		case Type::BackInOut:		return backInOut(t);
+		case Type::ElasticIn:		return elasticIn(t);
+		case Type::ElasticOut:		return elasticOut(t);
+		case Type::ElasticInOut:	return elasticInOut(t);
+		case Type::BounceIn:		return bounceIn(t);
+		case Type::BounceOut:		return bounceOut(t);
+		case Type::BounceInOut:		return bounceInOut(t);
+		default:					return t;
+		}
+	}
+
+	// 㻺ֵȷͣswitch 
+	template <Type T>
+	static inline float apply(float t)
+	{
+		return Ease::apply(T, t);
+	}
+
+	// ȡתĻͣ뻺
+	static Type reverse(
+		Type type
+	);
+
+	// ȡתĻ
+	static Func reverse(
+		const Func& func
+	);
+
+	// αƵΪ (x1, y1)  (x2, y2)
+	static Func bezier(
+		float x1,
+		float y1,
+		float x2,
+		float y2
+	);
+};
 
 
 // 
@@ -18,6 +176,7 @@ class Action :
 	public Object
 {
 	friend class ActionManager;
+	friend class TweenManager;
 	friend class Loop;
 	friend class Sequence;
 	friend class Spawn;
@@ -63,8 +222,10 @@ protected:
 	// ʼ
 	virtual void _init();
 
-	// ¶
-	virtual void _update();
+	// ¶dt Ϊ֡ʱ
+	virtual void _update(
+		float dt
+	);
 
 	// ȡ״̬
 	virtual bool _isDone();
@@ -82,8 +243,9 @@ protected:
 	bool	_running;
 	bool	_done;
 	bool	_initialized;
+	bool	_tweening;
 	Node *	_target;
-	float	_last;
+	float	_elapsed;
 };
 
 
@@ -91,28 +253,103 @@ protected:
 class FiniteTimeAction :
 	public Action
 {
+	friend class TweenManager;
+	friend class TweenGroup;
+
 public:
 	// ضʱĳ
 	explicit FiniteTimeAction(
 		float duration
 	);
 
+	virtual ~FiniteTimeAction();
+
+	// 
+	virtual void resume() override;
+
+	// ͣ
+	virtual void pause() override;
+
+	// ֹͣ
+	virtual void stop() override;
+
 	// ö
 	virtual void reset() override;
 
+	// û
+	void setEase(
+		Ease::Type type
+	);
+
+	// Զ建
+	void setEase(
+		const Ease::Func& func
+	);
+
+	// ȡ
+	Ease::Type getEaseType() const;
+
 protected:
 	// ʼ
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
 
-	// öʱ
-	virtual void _resetTime() override;
+	// Ƶһ
+	void _copyEase(
+		FiniteTimeAction * action,
+		bool reversed
+	) const;
+
+	// ʼ
+	virtual void _startWithTarget(
+		Node* target
+	) override;
+
+	// ɲ£֧ʱ false
+	virtual bool _startTween();
+
+	// ӵ
+	bool _addTween(
+		TweenManager::Property prop,
+		float startX,
+		float startY,
+		float deltaX,
+		float deltaY,
+		float height = 0,
+		int jumps = 0
+	);
+
+	// 
+	struct TweenParams
+	{
+		TweenManager::Property prop;
+		float startX;
+		float startY;
+		float deltaX;
+		float deltaY;
+		float height;
+		int jumps;
+	};
+
+	// Խڵ㵱ǰ״̬öĲ֧ʱ false
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const;
 
 protected:
 	float _duration;
 	float _delta;
+	float _progress;
+	Ease::Type _easeType;
+	Ease::Func _easeFunc;
+	bool  _tweenable;
+	int   _tweenIndex;
+	TweenManager::Property _tweenProperty;
 };
 
 
@@ -137,7 +374,18 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
+
+	// ɲ
+	virtual bool _startTween() override;
+
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
 
 protected:
 	Point	_startPos;
@@ -170,6 +418,12 @@ protected:
 	// ʼ
 	virtual void _init() override;
 
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
+
 protected:
 	Point _endPos;
 };
@@ -198,7 +452,18 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
+
+	// ɲ
+	virtual bool _startTween() override;
+
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
 
 protected:
 	Point	_startPos;
@@ -235,6 +500,12 @@ protected:
 	// ʼ
 	virtual void _init() override;
 
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
+
 protected:
 	Point _endPos;
 };
@@ -267,7 +538,18 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
+
+	// ɲ
+	virtual bool _startTween() override;
+
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
 
 protected:
 	float	_startScaleX;
@@ -307,6 +589,12 @@ protected:
 	// ʼ
 	virtual void _init() override;
 
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
+
 protected:
 	float	_endScaleX;
 	float	_endScaleY;
@@ -334,7 +622,18 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
+
+	// ɲ
+	virtual bool _startTween() override;
+
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
 
 protected:
 	float _startVal;
@@ -366,6 +665,12 @@ protected:
 	// ʼ
 	virtual void _init() override;
 
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
+
 protected:
 	float _endVal;
 };
@@ -422,7 +727,18 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
+
+	// ɲ
+	virtual bool _startTween() override;
+
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
 
 protected:
 	float _startVal;
@@ -454,6 +770,12 @@ protected:
 	// ʼ
 	virtual void _init() override;
 
+	// Խڵ㵱ǰ״̬öĲ
+	virtual bool _getTweenParams(
+		Node* target,
+		TweenParams& params
+	) const override;
+
 protected:
 	float _endVal;
 };
@@ -482,10 +804,9 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
-
-	// öʱ
-	virtual void _resetTime() override;
+	virtual void _update(
+		float dt
+	) override;
 
 protected:
 	float _delay;
@@ -519,7 +840,9 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
 
 	// öʱ
 	virtual void _resetTime() override;
@@ -551,7 +874,9 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
 
 protected:
 	Function<void()> _func;
@@ -595,7 +920,9 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
 
 	// öʱ
 	virtual void _resetTime() override;
@@ -643,7 +970,9 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
+	virtual void _update(
+		float dt
+	) override;
 
 	// öʱ
 	virtual void _resetTime() override;
@@ -653,6 +982,225 @@ protected:
 };
 
 
+// Ⱥ鲹䶯
+// ͬһʱڵ㣬ģ嶯ֻЧᱻƻ򵥶ִ
+class TweenGroup :
+	public Action
+{
+public:
+	explicit TweenGroup(
+		FiniteTimeAction * action,					/* ģ嶯λơԾš͸ȡת */
+		const std::vector<Node*>& targets = std::vector<Node*>(),	/* ִĿ */
+		float stagger = 0							/* Ŀ */
+	);
+
+	virtual ~TweenGroup();
+
+	// ִĿ
+	void add(
+		Node * target,
+		float offset = 0	/* ӳ */
+	);
+
+	// ӶִĿ
+	void add(
+		const std::vector<Node*>& targets,	/* ִĿ */
+		float stagger = 0					/* Ŀ */
+	);
+
+	// ȡִĿ
+	size_t getTargetCount() const;
+
+	// ȡöĿ
+	virtual TweenGroup * clone() const override;
+
+	// ȡöĵת
+	virtual TweenGroup * reverse() const override;
+
+	// ö
+	virtual void reset() override;
+
+protected:
+	// ʼ
+	virtual void _init() override;
+
+	// ¶
+	virtual void _update(
+		float dt
+	) override;
+
+	// Ŀ״ʱ¼ʼֵ
+	void _startTarget(
+		size_t index
+	);
+
+protected:
+	FiniteTimeAction *		_action;
+	TweenManager::Property	_prop;
+	float					_height;
+	int						_jumps;
+	float					_totalDuration;
+	bool					_uniform;
+	std::vector<Node*>		_targets;
+	std::vector<float>		_offsets;
+	std::vector<float>		_startX;
+	std::vector<float>		_startY;
+	std::vector<float>		_deltaX;
+	std::vector<float>		_deltaY;
+	std::vector<float>		_prevX;
+	std::vector<float>		_prevY;
+	std::vector<float>		_values;
+	std::vector<float>		_progress;
+	std::vector<size_t>		_active;
+};
+
+
+// ű
+// ʽü¼һϵв裬谴ֵͬһУ
+// ִʱͷɣΪÿһͱĶ
+class Script :
+	public Action
+{
+public:
+	Script();
+
+	virtual ~Script();
+
+	// ȴһʱ
+	Script * wait(
+		float duration	/* ȴʱ */
+	);
+
+	// ȴֱ
+	Script * waitUntil(
+		const Function<bool()>& cond	/*  */
+	);
+
+	// ִк
+	Script * call(
+		const Function<void()>& func	/*  */
+	);
+
+	// ƶָ
+	Script * moveTo(
+		Node * node,		/* Ŀڵ㣬ΪʱΪִиöĽڵ */
+		const Point& pos,	/* Ŀ */
+		float duration,		/* ʱ */
+		Ease::Type ease = Ease::Type::Linear
+	);
+
+	// ƶ
+	Script * moveBy(
+		Node * node,		/* Ŀڵ㣬ΪʱΪִиöĽڵ */
+		const Vector2& vec,	/* ƶ */
+		float duration,		/* ʱ */
+		Ease::Type ease = Ease::Type::Linear
+	);
+
+	// ŵָС
+	Script * scaleTo(
+		Node * node,		/* Ŀڵ㣬ΪʱΪִиöĽڵ */
+		float scaleX,		/* Ŀֵ */
+		float scaleY,		/* Ŀֵ */
+		float duration,		/* ʱ */
+		Ease::Type ease = Ease::Type::Linear
+	);
+
+	// תָǶ
+	Script * rotateTo(
+		Node * node,		/* Ŀڵ㣬ΪʱΪִиöĽڵ */
+		float rotation,		/* ĿǶ */
+		float duration,		/* ʱ */
+		Ease::Type ease = Ease::Type::Linear
+	);
+
+	// 䵽ָ͸
+	Script * opacityTo(
+		Node * node,		/* Ŀڵ㣬ΪʱΪִиöĽڵ */
+		float opacity,		/* Ŀ͸ */
+		float duration,		/* ʱ */
+		Ease::Type ease = Ease::Type::Linear
+	);
+
+	// Ԥռ䣬¼űʱηڴ
+	void reserve(
+		size_t count
+	);
+
+	// ȡ
+	size_t getStepCount() const;
+
+	// ȡöĿ
+	virtual Script * clone() const override;
+
+	// ȡöĵת
+	virtual Script * reverse() const override
+	{
+		E2D_WARNING(L"reverse() not supported in Script");
+		return nullptr;
+	}
+
+	// ö
+	virtual void reset() override;
+
+protected:
+	// ʼ
+	virtual void _init() override;
+
+	// ¶
+	virtual void _update(
+		float dt
+	) override;
+
+	// ִеǰ裬ʱ true
+	bool _runStep();
+
+protected:
+	// 
+	enum class StepType : int
+	{
+		Wait,
+		WaitUntil,
+		Call,
+		Move,
+		Scale,
+		Rotate,
+		Opacity
+	};
+
+	// ű
+	struct Step
+	{
+		StepType	type;
+		Node *		node;
+		float		duration;
+		float		x;
+		float		y;
+		bool		relative;
+		Ease::Type	ease;
+		size_t		func;
+	};
+
+	Step * _addStep(
+		StepType type,
+		Node * node,
+		float duration
+	);
+
+protected:
+	std::vector<Step>				_steps;
+	std::vector<Function<void()>>	_calls;
+	std::vector<Function<bool()>>	_conds;
+	size_t	_currIndex;
+	bool	_stepStarted;
+	float	_stepElapsed;
+	float	_startX;
+	float	_startY;
+	float	_deltaX;
+	float	_deltaY;
+};
+
+
 // ֡
 class Animation :
 	public Object
@@ -743,10 +1291,9 @@ protected:
 	virtual void _init() override;
 
 	// ¶
-	virtual void _update() override;
-
-	// öʱ
-	virtual void _resetTime() override;
+	virtual void _update(
+		float dt
+	) override;
 
 protected:
 	UINT _frameIndex;
@@ -754,4 +1301,127 @@ protected:
 };
 
 
+// 
+// ֡ͬһͼƬеĲü
+class SpriteSheet :
+	public Object
+{
+public:
+	SpriteSheet();
+
+	explicit SpriteSheet(
+		Image * image,			/* ͼ */
+		float interval = 1		/* ֡룩 */
+	);
+
+	explicit SpriteSheet(
+		Image * image,			/* ͼ */
+		int cols,				/*  */
+		int rows,				/*  */
+		float interval = 1		/* ֡룩 */
+	);
+
+	virtual ~SpriteSheet();
+
+	// ͼ
+	void setImage(
+		Image * image
+	);
+
+	// ӹؼ֡
+	void add(
+		const Rect& frame	/* ؼ֡ͼеĲü */
+	);
+
+	// Ӷؼ֡
+	void add(
+		const std::vector<Rect>& frames	/* ؼ֡б */
+	);
+
+	// озͼӹؼ֡
+	void split(
+		int cols,	/*  */
+		int rows	/*  */
+	);
+
+	// ȡͼ
+	Image * getImage() const;
+
+	// ȡؼ֡
+	const std::vector<Rect>& getFrames() const;
+
+	// ȡ֡
+	float getInterval() const;
+
+	// ÿһ֡ʱ
+	void setInterval(
+		float interval		/* ֡룩 */
+	);
+
+	// ȡĿ
+	SpriteSheet * clone() const;
+
+	// ȡĵת
+	SpriteSheet * reverse() const;
+
+protected:
+	float	_interval;
+	Image *	_image;
+	std::vector<Rect> _frames;
+};
+
+
+// 
+// ֻ޸ľĲüΣ滻ͼƬ
+class SheetAnimate :
+	public Action
+{
+public:
+	SheetAnimate();
+
+	explicit SheetAnimate(
+		SpriteSheet * sheet
+	);
+
+	virtual ~SheetAnimate();
+
+	// ȡ
+	virtual SpriteSheet * getSpriteSheet() const;
+
+	// þ
+	virtual void setSpriteSheet(
+		SpriteSheet * sheet
+	);
+
+	// ȡöĿ
+	virtual SheetAnimate * clone() const override;
+
+	// ȡöĵת
+	virtual SheetAnimate * reverse() const override;
+
+	// ö
+	virtual void reset() override;
+
+protected:
+	// ʼ
+	virtual void _init() override;
+
+	// ¶
+	virtual void _update(
+		float dt
+	) override;
+
+	// ʾָ֡
+	void _showFrame(
+		size_t index
+	);
+
+protected:
+	size_t _frameIndex;
+	Sprite * _sprite;
+	SpriteSheet * _sheet;
+	Image * _image;		/* Ϊ鴴 Image */
+};
+
+
 }
\ No newline at end of file
@@ -42,6 +42,28 @@ public:
 	// ϷǷͣ
 	static bool isPaused();
 
+	// ʱűӰ춯ͶʱĬΪ 1
+	static void setTimeScale(
+		float scale
+	);
+
+	// ȡʱű
+	static float getTimeScale();
+
+	// ù̶֡룩Ϊ 0 ʱʹʵ֡
+	static void setFixedDeltaTime(
+		float dt
+	);
+
+	// ȡ̶֡룩
+	static float getFixedDeltaTime();
+
+	// ʱͳƽ dt 루Ⱦ棩
+	// ûдʱ֡ȷԵģ
+	static void step(
+		float dt
+	);
+
 	// ȡϷ
 	static String getName();
 };
@@ -184,12 +206,173 @@ private:
 };
 
 
+// ֡ʱ¼
+// λ֡֡͸׶εĺʱ룩
+class FrameHistory
+{
+public:
+	// ͳƵĽ׶
+	enum Phase : int
+	{
+		Update,		/* 롢¼ʱͳ */
+		Actions,	/* Ͳ䶯 */
+		Render,		/* Ⱦ */
+		GC,			/* ڴ */
+		PhaseCount
+	};
+
+	// һ֡ļ¼
+	struct Sample
+	{
+		float frameTime;				/* ֡ */
+		float phaseTimes[PhaseCount];	/* ׶κʱ */
+	};
+
+public:
+	explicit FrameHistory(
+		size_t capacity = 240	/* ֡ */
+	);
+
+	// һ֡ļ¼ʱļ¼
+	void push(
+		const Sample& sample
+	);
+
+	// ռ¼
+	void clear();
+
+	// ȡ¼֡
+	size_t getCount() const;
+
+	// ȡౣ֡
+	size_t getCapacity() const;
+
+	// ȡһ֡ļ¼0 Ϊһ֡
+	const Sample& get(
+		size_t index
+	) const;
+
+	// ȡм¼ƽֵ
+	Sample getAverage() const;
+
+	// ȡ֡
+	float getMaxFrameTime() const;
+
+private:
+	size_t	_head;
+	size_t	_count;
+	double	_frameTimeSum;
+	double	_phaseTimeSums[PhaseCount];
+	std::vector<Sample> _samples;
+};
+
+
+// ͳ
+// ¼ÿһ֡׶εĺʱRenderer::showFps 򿪵ʾЩ
+class Profiler
+{
+	friend class Game;
+	friend class Renderer;
+
+public:
+	// ȡ֡ʱ¼
+	static const FrameHistory& getHistory();
+
+	// ȡ֡ʣÿ 0.3 ˢһΣ
+	static float getFps();
+
+private:
+	// ʼͳһ׶
+	static void __beginPhase(
+		FrameHistory::Phase phase
+	);
+
+	// ͳһ׶Σͬһ֡жͳƵĺʱۼ
+	static void __endPhase(
+		FrameHistory::Phase phase
+	);
+
+	// һ֡¼һ֡
+	static void __endFrame();
+
+	// ÿ 0.3 ʱƽֵˢ֣Ƿ仯
+	static bool __updateText(
+		float totalTime,
+		String& text
+	);
+};
+
+
 class Listener;
 
+// ״̬
+// 浱ǰ֡һ֡µİÿθʱͳһ֡ºɿİ
+// ѯʱֻһλ
+class KeyState
+{
+public:
+	KeyState();
+
+	// Ա֡µİ״̬
+	void update(
+		const KeySet& current
+	);
+
+	// ״̬
+	void reset();
+
+	// Ƿ
+	bool isDown(
+		KeyCode::Value key
+	) const;
+
+	// Ƿڱ֡
+	bool isPress(
+		KeyCode::Value key
+	) const;
+
+	// Ƿڱ֡ɿ
+	bool isRelease(
+		KeyCode::Value key
+	) const;
+
+	// ȡµİ
+	const KeySet& getDown() const;
+
+	// ȡ֡µİ
+	const KeySet& getPressed() const;
+
+	// ȡ֡ɿİ
+	const KeySet& getReleased() const;
+
+private:
+	KeySet _down;
+	KeySet _pressed;
+	KeySet _released;
+};
+
+
+// һ֡״̬
+struct InputFrame
+{
+	float	deltaTime;		/* ֡ */
+	KeySet	keys;			/* µİ */
+	BYTE	mouseButtons;	/* µ갴 MouseCode ȡλ */
+	float	mouseX;			/*  */
+	float	mouseY;
+	float	mouseDeltaX;	/*  */
+	float	mouseDeltaY;
+	float	mouseDeltaZ;
+
+	InputFrame();
+};
+
+
 // 
 class Input
 {
 	friend class Game;
+	friend class InputRecorder;
 
 public:
 	// ĳǷ
@@ -207,6 +390,29 @@ public:
 		KeyCode::Value key
 	);
 
+	// ⼯Ƿа
+	static bool isAnyDown(
+		const KeySet& keys
+	);
+
+	// ⼯еİǷȫ
+	static bool isAllDown(
+		const KeySet& keys
+	);
+
+	// ⼯Ƿа
+	static bool isAnyPress(
+		const KeySet& keys
+	);
+
+	// ⼯Ƿаɿ
+	static bool isAnyRelease(
+		const KeySet& keys
+	);
+
+	// ȡ״̬
+	static const KeyState& getKeyState();
+
 	// 갴Ƿ
 	static bool isDown(
 		MouseCode::Value code
@@ -247,11 +453,252 @@ private:
 	// ˢϢ
 	static void __update();
 
+	// ȡ֡״̬
+	static void __getFrame(
+		InputFrame& frame
+	);
+
+	// ûطŵ״̬豸
+	static void __setFrame(
+		const InputFrame& frame
+	);
+
 	// ж DirectInput
 	static void __uninit();
 };
 
 
+// ¼
+// ÿ֡״̬ʹ¼дļطʱļеݴ
+// 豸룬ʹͬһβԷУڱȽϲͬ汾֡ʱ
+class InputRecorder
+{
+	friend class Game;
+	friend class EventQueue;
+
+public:
+	// طͳ
+	struct Stats
+	{
+		UINT32 frames;			/* ѻطŵ֡ */
+		double totalTime;		/* طܺʱ룩 */
+		float maxFrameTime;		/* ֡ʱ룩 */
+	};
+
+public:
+	// ʼ¼
+	static bool startRecording(
+		const String& filePath
+	);
+
+	// ֹͣ¼Ʋرļ
+	static void stopRecording();
+
+	// Ƿ¼
+	static bool isRecording();
+
+	// ʼط
+	static bool startReplay(
+		const String& filePath
+	);
+
+	// ֹͣط
+	static void stopReplay();
+
+	// Ƿڻط
+	static bool isReplaying();
+
+	// ûطŽʱĻص
+	static void setReplayEndCallback(
+		const Function<void()>& func
+	);
+
+	// ûдڵ»طһ֡ƽϷ߼طŽʱ false
+	static bool stepReplay();
+
+	// ȡǰ¼ƻطŵ֡
+	static UINT32 getFrameIndex();
+
+	// ȡطͳ
+	static Stats getStats();
+
+private:
+	// ¼ƻطһ֡طʱ dt 滻Ϊ¼ʱ֡
+	static bool __update(
+		float& dt
+	);
+
+	// ¼һ¼
+	static void __recordEvent(
+		UINT type,
+		float x,
+		float y,
+		float delta,
+		int code,
+		int count
+	);
+
+	// رļ
+	static void __uninit();
+};
+
+
+// λļ
+struct GlyphKey
+{
+	const void *	fontFace;	/*  */
+	float			fontSize;	/* ֺ */
+	UINT16			glyph;		/* α */
+	float			outline;	/* ߿Ϊ 0 ʱʾ */
+	int				lineJoin;	/* ཻʽ */
+
+	bool operator== (const GlyphKey& other) const;
+};
+
+
+// ιդӿ
+// βλͼҳϣͼŲͻ GlyphCache 
+class GlyphRasterizer
+{
+public:
+	virtual ~GlyphRasterizer() {}
+
+	// λͼĴСԼԭλͼϽǵλ
+	virtual bool measure(
+		const GlyphKey& key,
+		int& width,
+		int& height,
+		float& originX,
+		float& originY
+	) = 0;
+
+	// ͼҳ
+	virtual bool createPage(
+		int page,
+		int width,
+		int height
+	) = 0;
+
+	// λͼҳϣԭλ (originX, originY)
+	virtual bool draw(
+		const GlyphKey& key,
+		int page,
+		float originX,
+		float originY
+	) = 0;
+
+	// ͷͼҳ
+	virtual void clearPages() = 0;
+};
+
+
+// λ
+// ÿΣ塢ֺšαšߣֻդһΣ֮ͼֱȡã
+// ͼҳʱ¿ʼ
+class GlyphCache
+{
+public:
+	// ͼеλ
+	struct Entry
+	{
+		int		page;		/* ͼҳ */
+		int		x;			/* λͼϽ X  */
+		int		y;			/* λͼϽ Y  */
+		int		width;		/* λͼȣΪ 0 ʱʾհ */
+		int		height;		/* λͼ߶ */
+		float	originX;	/* ԭλͼϽǵλ */
+		float	originY;
+	};
+
+	// ͳ
+	struct Stats
+	{
+		int		pageCount;	/* ͼҳ */
+		int		glyphCount;	/*  */
+		float	occupancy;	/* ͼռʣ / ͼ */
+		UINT64	hits;		/* д */
+		UINT64	misses;		/* δд */
+		int		resets;		/* ͼյĴ */
+
+		// ȡ
+		float getHitRate() const;
+	};
+
+public:
+	explicit GlyphCache(
+		GlyphRasterizer * rasterizer,	/* դӿ */
+		int pageWidth = 1024,			/* ͼҳ */
+		int pageHeight = 1024,			/* ͼҳ߶ */
+		int maxPages = 4,				/* ʹõͼҳ */
+		int padding = 1					/* μ */
+	);
+
+	~GlyphCache();
+
+	// ȡΣڻʱйդʧʱؿָ롣
+	// պ֮ǰصָʧЧ
+	const Entry * get(
+		const GlyphKey& key
+	);
+
+	// ջ
+	void clear();
+
+	// ȡͳ
+	Stats getStats() const;
+
+	// ͳ
+	void resetStats();
+
+private:
+	GlyphCache(const GlyphCache&);
+
+	GlyphCache& operator= (const GlyphCache&);
+
+	// ͼΪηλ
+	bool _allocate(
+		int width,
+		int height,
+		int& page,
+		int& x,
+		int& y
+	);
+
+private:
+	// ͼҳеһ
+	struct Shelf
+	{
+		int y;
+		int height;
+		int x;
+	};
+
+	// ͼҳ
+	struct Page
+	{
+		std::vector<Shelf> shelves;
+		int nextShelfY;
+	};
+
+	struct KeyHasher
+	{
+		size_t operator()(const GlyphKey& key) const;
+	};
+
+	GlyphRasterizer *	_rasterizer;
+	int					_pageWidth;
+	int					_pageHeight;
+	int					_maxPages;
+	int					_padding;
+	INT64				_usedArea;
+	UINT64				_hits;
+	UINT64				_misses;
+	int					_resets;
+	std::vector<Page>	_pages;
+	std::unordered_map<GlyphKey, Entry, KeyHasher> _entries;
+};
+
+
 // Ⱦ
 class Renderer
 {
@@ -267,11 +714,20 @@ public:
 		Color color
 	);
 
-	// ʾ FPS
+	// ʾ壨֡ʡ֡ʱߺ͸׶κʱ
 	static void showFps(
 		bool show = true
 	);
 
+	// ʹλȾ֣ĬϹرգ
+	// ÿֻդһΣ֮ͼֱӻƣʺϴšת֣źֻģ
+	static void enableGlyphCache(
+		bool enable = true
+	);
+
+	// ȡλͳ
+	static GlyphCache::Stats getGlyphCacheStats();
+
 	// ȡϵͳ DPI 
 	static float getDpiScaleX();
 
@@ -293,6 +749,11 @@ public:
 	// ȡ IDWriteFactory 
 	static IDWriteFactory * getIDWriteFactory();
 
+	// ȡӦָʽͬ干ͬһʽ󣬲Ҫ޸Ļͷ
+	static IDWriteTextFormat * getTextFormat(
+		const Font& font
+	);
+
 	// Ⱦʽ
 	static void SetTextStyle(
 		const Color& fillColor,
@@ -320,6 +781,9 @@ private:
 	// ȾϷ
 	static void __render();
 
+	// Ⱦ
+	static void __renderOverlay();
+
 	// 豸޹Դ
 	static bool __createDeviceIndependentResources();
 
@@ -335,6 +799,8 @@ private:
 
 
 // ־
+// ־ڵ߳иʽУɺ̨߳ͳһ
+// ͬһ־ÿĴޣĲֻ
 class Logger
 {
 public:
@@ -347,12 +813,29 @@ public:
 	// ־Ϣ
 	static void messageln(String format, ...);
 
+	// ־Ϣ
+	static void messageln(const wchar_t* format, ...);
+
 	// 
 	static void warningln(String format, ...);
 
-	// 
+	// 
+	static void warningln(const wchar_t* format, ...);
+
+	// 
 	static void errorln(String format, ...);
 
+	// 
+	static void errorln(const wchar_t* format, ...);
+
+	// е־
+	static void flush();
+
+	// ͬһ־ÿĴΪ 0 ʱƣĬ 10 Σ
+	static void setRateLimit(
+		UINT32 count
+	);
+
 	// /رտ̨
 	static void showConsole(bool show = true);
 };
@@ -433,8 +916,18 @@ namespace __gc_helper
 // Log macros
 //
 
-#ifndef E2D_LOG
+// ־ȼڸõȼ־겻κδ
+// 0: ȫ  1: ʹ  2: ֻ  3: ȫر
+#ifndef E2D_LOG_LEVEL
 #	ifdef E2D_DEBUG
+#		define E2D_LOG_LEVEL 0
+#	else
+#		define E2D_LOG_LEVEL 1
+#	endif
+#endif
+
+#ifndef E2D_LOG
+#	if E2D_LOG_LEVEL <= 0
 #		define E2D_LOG(FORMAT, ...) easy2d::Logger::messageln(FORMAT, __VA_ARGS__)
 #	else
 #		define E2D_LOG __noop
@@ -442,11 +935,19 @@ namespace __gc_helper
 #endif
 
 #ifndef E2D_WARNING
-#	define E2D_WARNING(FORMAT, ...) easy2d::Logger::warningln(FORMAT, __VA_ARGS__)
+#	if E2D_LOG_LEVEL <= 1
+#		define E2D_WARNING(FORMAT, ...) easy2d::Logger::warningln(FORMAT, __VA_ARGS__)
+#	else
+#		define E2D_WARNING __noop
+#	endif
 #endif
 
 #ifndef E2D_ERROR
-#	define E2D_ERROR(FORMAT, ...) easy2d::Logger::errorln(FORMAT, __VA_ARGS__)
+#	if E2D_LOG_LEVEL <= 2
+#		define E2D_ERROR(FORMAT, ...) easy2d::Logger::errorln(FORMAT, __VA_ARGS__)
+#	else
+#		define E2D_ERROR __noop
+#	endif
 #endif
 
 #ifndef E2D_ERROR_IF_FAILED
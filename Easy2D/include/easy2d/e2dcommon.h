@@ -1,5 +1,6 @@
 #pragma once
 #include <ostream>
+#include <unordered_map>
 #include <easy2d/e2dmacros.h>
 #include <easy2d/e2dmath.h>
 
@@ -215,6 +216,8 @@ private:
 class Image :
 	public Object
 {
+	friend class TextureAtlas;
+
 public:
 	Image();
 
@@ -238,6 +241,11 @@ public:
 		const Rect& cropRect	/* ü */
 	);
 
+	explicit Image(
+		ID2D1Bitmap * bitmap,	/* λͼ */
+		const Rect& cropRect	/* ü */
+	);
+
 	virtual ~Image();
 
 	// ͼƬļ
@@ -309,12 +317,263 @@ protected:
 		ID2D1Bitmap * bitmap
 	);
 
+	// λͼ뻺棬 clearCache һͬͷ
+	static void _cacheBitmap(
+		ID2D1Bitmap * bitmap
+	);
+
 protected:
 	Rect _cropRect;
 	ID2D1Bitmap * _bitmap;
 };
 
 
+// Skyline Ų
+// άһҳǰġߡ¾ηʹ䶥͵λãֵֻ㣬Ⱦ
+class SkylinePacker
+{
+public:
+	SkylinePacker(
+		int width,				/* ҳ */
+		int height				/* ҳ߶ */
+	);
+
+	// һΣҳзŲʱ false
+	bool insert(
+		int width,
+		int height,
+		int& outX,
+		int& outY
+	);
+
+	// ȡʹõĸ߶
+	int getUsedHeight() const;
+
+private:
+	// ϵһ
+	struct Segment
+	{
+		int x;
+		int y;
+		int width;
+	};
+
+	// жϾܷڵ index ϣطú y 
+	bool _fit(
+		size_t index,
+		int width,
+		int height,
+		int& outY
+	) const;
+
+	void _addSegment(
+		size_t index,
+		int x,
+		int y,
+		int width
+	);
+
+private:
+	int _width;
+	int _height;
+	int _usedHeight;
+	std::vector<Segment> _skyline;
+};
+
+
+// ͼ
+// ʱСͼƬλͼУͼƬͼλͼеĲü
+class TextureAtlas :
+	public Object
+{
+public:
+	// ͳ
+	struct Stats
+	{
+		int		pageCount;		/* ͼҳ */
+		int		imageCount;		/* ѴͼƬ */
+		float	efficiency;		/* ռʣͼƬ / ͼ */
+		float	loadTime;		/* ͼƬʱ룩 */
+		float	packTime;		/* Ųλͼʱ룩 */
+	};
+
+public:
+	explicit TextureAtlas(
+		int pageWidth = 2048,	/* ͼҳ */
+		int pageHeight = 2048,	/* ͼҳ߶ */
+		int padding = 1			/* ͼƬ */
+	);
+
+	virtual ~TextureAtlas();
+
+	// ͼƬļ
+	bool add(
+		const String& filePath	/* ͼƬļ· */
+	);
+
+	// ļеͼƬļӵ
+	int addFolder(
+		const String& dirPath	/* ļ· */
+	);
+
+	// ӵͼƬ
+	bool pack();
+
+	// ȡͼƬÿηһµ Image 
+	Image * getImage(
+		const String& filePath	/* ʱʹõͼƬļ· */
+	) const;
+
+	// ȡͳ
+	const Stats& getStats() const;
+
+	// ͼеλ
+	struct Placement
+	{
+		int width;				/* οȣ룩 */
+		int height;				/* θ߶ȣ룩 */
+		int page;				/* ڵͼҳ */
+		int x;					/* Ͻ X  */
+		int y;					/* Ͻ Y  */
+	};
+
+	// һεŲ pack ʹͬĹ򣬵ͼƬҲλͼ
+	// ûȾ豸ʱ߼㣻pageHeights ÿҳʵʹõĸ߶
+	static bool layout(
+		std::vector<Placement>& rects,
+		std::vector<int>& pageHeights,
+		int pageWidth,
+		int pageHeight,
+		int padding
+	);
+
+protected:
+	// ͼƬ
+	struct Entry
+	{
+		size_t				hash;
+		String				name;
+		UINT				width;
+		UINT				height;
+		std::vector<BYTE>	pixels;
+		int					page;
+		UINT				x;
+		UINT				y;
+	};
+
+protected:
+	int		_pageWidth;
+	int		_pageHeight;
+	int		_padding;
+	bool	_packed;
+	Stats	_stats;
+	std::vector<Entry>			_entries;
+	std::vector<ID2D1Bitmap*>	_pages;
+};
+
+
+// λͼ
+// ȡ BMFont ıʽļŰֻ򵥵ֵ㣬Ⱦ
+class BitmapFont :
+	public Object
+{
+public:
+	// 
+	struct Glyph
+	{
+		Rect	rect;		/* ҳе */
+		float	offsetX;	/* ʱڱλõĺƫ */
+		float	offsetY;	/* ʱжƫ */
+		float	advance;	/* ƺλǰľ */
+		int		page;		/* ҳ */
+	};
+
+	// Űξ
+	struct Quad
+	{
+		Rect	src;		/* ҳе */
+		Rect	dest;		/* еλ */
+		int		page;		/* ҳ */
+	};
+
+public:
+	BitmapFont();
+
+	explicit BitmapFont(
+		const String& filePath	/* ļ· */
+	);
+
+	virtual ~BitmapFont();
+
+	// ļõ·ļڵļУ
+	bool open(
+		const String& filePath	/* ļ· */
+	);
+
+	// ֻļ
+	bool parse(
+		const void * data,		/* ļ */
+		size_t size				/* ݴС */
+	);
+
+	// ҳͼеͼƬ
+	void setPage(
+		int id,					/* ҳţѽļʱܳҳ */
+		Image * image			/*  */
+	);
+
+	// ȡҳ
+	Image * getPage(
+		int id
+	) const;
+
+	// ȡҳ
+	int getPageCount() const;
+
+	// ȡַӦΣʱؿָ
+	const Glyph * getGlyph(
+		UINT32 ch
+	) const;
+
+	// ȡַ֮־
+	float getKerning(
+		UINT32 first,
+		UINT32 second
+	) const;
+
+	// ȡи
+	float getLineHeight() const;
+
+	// ȡߵжľ
+	float getBase() const;
+
+	// Űֵ֣ĿȺ͸߶ȣȱʧַ '?' 棩
+	Size layout(
+		const String& text,				/*  */
+		std::vector<Quad>& quads,		/* Ű */
+		float alignment = 0				/* ֵĶ0 룬0.5 У1 Ҷ룩 */
+	) const;
+
+protected:
+	// 
+	void _addGlyph(
+		UINT32 ch,
+		const Glyph& glyph
+	);
+
+protected:
+	float	_lineHeight;
+	float	_base;
+	int		_pageCount;
+	int		_asciiGlyphs[128];
+	std::vector<Glyph>					_glyphs;
+	std::unordered_map<UINT32, int>		_glyphIndices;
+	std::unordered_map<UINT64, float>	_kernings;
+	std::vector<String>					_pageFiles;
+	std::vector<Image*>					_pages;
+};
+
+
 // ֵ
 struct MouseCode
 {
@@ -412,6 +671,62 @@ struct KeyCode
 };
 
 
+// 
+// ԼֵΪ±λͼһμ
+class KeySet
+{
+	friend class KeyState;
+	friend class InputRecorder;
+
+public:
+	KeySet();
+
+	KeySet(
+		std::initializer_list<KeyCode::Value> keys
+	);
+
+	// Ӱ
+	KeySet& add(
+		KeyCode::Value key
+	);
+
+	// Ƴ
+	KeySet& remove(
+		KeyCode::Value key
+	);
+
+	// ռ
+	void clear();
+
+	// Ƿ
+	bool contains(
+		KeyCode::Value key
+	) const;
+
+	// Ƿһеһ
+	bool containsAny(
+		const KeySet& other
+	) const;
+
+	// Ƿһеа
+	bool containsAll(
+		const KeySet& other
+	) const;
+
+	// ǷΪ
+	bool isEmpty() const;
+
+	// ȡеİ
+	int getCount() const;
+
+	bool operator== (const KeySet& other) const;
+	bool operator!= (const KeySet& other) const;
+
+private:
+	UINT32 _bits[8];
+};
+
+
 // ¼
 struct Event
 {
@@ -491,6 +806,32 @@ struct KeyUpEvent
 };
 
 
+// ¼
+struct EventMask
+{
+	enum Value : UINT
+	{
+		None		= 0,
+		MouseMove	= 1u << Event::MouseMove,	/* ƶ */
+		MouseDown	= 1u << Event::MouseDown,	/* 갴 */
+		MouseUp		= 1u << Event::MouseUp,		/* ̧ */
+		MouseWheel	= 1u << Event::MouseWheel,	/* ֻ */
+		KeyDown		= 1u << Event::KeyDown,		/*  */
+		KeyUp		= 1u << Event::KeyUp,		/* ̧ */
+		Custom		= 1u << 31,					/* Զ͵¼ */
+
+		Mouse		= MouseMove | MouseDown | MouseUp | MouseWheel,
+		Key			= KeyDown | KeyUp,
+		All			= 0xFFFFFFFF
+	};
+
+	// ȡ¼ͶӦ
+	static UINT of(
+		UINT type
+	);
+};
+
+
 // ¼
 class Listener
 	: public Object
@@ -505,7 +846,8 @@ public:
 	Listener(
 		const Callback& func,
 		const String& name,
-		bool paused
+		bool paused,
+		UINT eventMask = EventMask::All	/* ¼ */
 	);
 
 	// 
@@ -530,6 +872,14 @@ public:
 		const Callback& func
 	);
 
+	// ȡ¼
+	UINT getEventMask() const;
+
+	// Ƿָ͵¼
+	bool isListening(
+		UINT type
+	) const;
+
 	// ¼
 	virtual void handle(Event* evt);
 
@@ -540,6 +890,7 @@ public:
 protected:
 	bool _running;
 	bool _done;
+	UINT _eventMask;
 	String _name;
 	Callback _callback;
 };
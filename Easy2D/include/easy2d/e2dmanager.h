@@ -12,6 +12,7 @@ class Node;
 class Scene;
 class Timer;
 class Action;
+class FiniteTimeAction;
 class Transition;
 
 
@@ -104,7 +105,9 @@ public:
 
 private:
 	// ¶״̬
-	static void __update();
+	static void __update(
+		float dt
+	);
 
 	// ڽڵϵж
 	static void __resumeAllBindedWith(
@@ -134,4 +137,181 @@ private:
 };
 
 
+// 
+// ֱ ActionManager ִеĳᱻռ
+// ͷֱ洢ÿ֡ͳһ
+class TweenManager
+{
+	friend class Game;
+	friend class ActionManager;
+	friend class FiniteTimeAction;
+	friend class Node;
+
+public:
+	// 
+	enum class Property : int
+	{
+		Position,	/*  */
+		Jump,		/* Ծ */
+		Scale,		/*  */
+		Rotation,	/* תǶ */
+		Opacity		/* ͸ */
+	};
+
+public:
+	// ȡµĲ
+	static size_t getCount();
+
+	// ȡָµĲ
+	static size_t getCount(
+		Property prop
+	);
+
+private:
+	// Ӳ
+	static bool __add(
+		FiniteTimeAction * action,
+		Property prop,
+		float startX,
+		float startY,
+		float deltaX,
+		float deltaY,
+		float height,
+		int jumps
+	);
+
+	// Ƴ
+	static void __remove(
+		FiniteTimeAction * action
+	);
+
+	// ͣ
+	static void __setPaused(
+		FiniteTimeAction * action,
+		bool paused
+	);
+
+	// ²
+	static void __update(
+		float dt
+	);
+
+	// °ڽڵϵĲʱű
+	static void __updateTimeScale(
+		Node * target
+	);
+
+	// հڽڵϵв
+	static void __clearAllBindedWith(
+		Node * target
+	);
+
+	// Դ
+	static void __uninit();
+};
+
+
+// ¼
+// Ϣ¼ȽУÿ֡Ϸ߼ǰͳһַ
+// ͬһ֡ƶ¼ֻһĹ¼ϲ
+class EventQueue
+{
+	friend class Game;
+	friend class InputRecorder;
+
+public:
+	// ¼ͳ
+	struct Stats
+	{
+		UINT32 received;	/* յԭʼ¼ */
+		UINT32 dispatched;	/* ʵʷַ¼ */
+		UINT32 coalesced;	/* ϲ¼ */
+	};
+
+public:
+	// ƶ¼
+	static void pushMouseMove(
+		float x,
+		float y
+	);
+
+	// 갴¼
+	static void pushMouseDown(
+		float x,
+		float y,
+		MouseCode::Value btn
+	);
+
+	// ̧¼
+	static void pushMouseUp(
+		float x,
+		float y,
+		MouseCode::Value btn
+	);
+
+	// ¼
+	static void pushMouseWheel(
+		float x,
+		float y,
+		float delta
+	);
+
+	// Ӱ¼
+	static void pushKeyDown(
+		KeyCode::Value key,
+		int count
+	);
+
+	// Ӱ̧¼
+	static void pushKeyUp(
+		KeyCode::Value key,
+		int count
+	);
+
+	// ַе¼
+	static void flush();
+
+	// ȡȴַ¼
+	static size_t getPendingCount();
+
+	// ûرƶ͹¼ĺϲĬã
+	static void setCoalescing(
+		bool enabled
+	);
+
+	// ȡ¼ͳ
+	static Stats getStats();
+
+	// ¼ͳ
+	static void resetStats();
+
+private:
+	// Ӵڲ¼طʱԣ¼ʱͬʱд¼
+	static void __push(
+		UINT type,
+		float x,
+		float y,
+		float delta,
+		int code,
+		int count
+	);
+
+	// ӻطŵ¼
+	static void __pushReplayed(
+		UINT type,
+		float x,
+		float y,
+		float delta,
+		int code,
+		int count
+	);
+
+	// ַ֡¼
+	static void __dispatch();
+
+	// Դ
+	static void __uninit();
+};
+
+
 }
\ No newline at end of file
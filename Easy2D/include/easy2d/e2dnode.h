@@ -109,6 +109,9 @@ public:
 	// ȡڵ͸
 	float getOpacity() const;
 
+	// ȡڵʱű
+	float getTimeScale() const;
+
 	// ȡڵ
 	Property getProperty() const;
 
@@ -257,6 +260,12 @@ public:
 		float opacity
 	);
 
+	// ýڵʱűֻӰڸýڵϵĶ
+	// ĬΪ 1.0f
+	void setTimeScale(
+		float scale
+	);
+
 	// êĺλ
 	// ĬΪ 0, Χ [0, 1]
 	void setAnchorX(
@@ -382,7 +391,8 @@ public:
 	Listener* addListener(
 		const Listener::Callback& func,	/* ûʱִк */
 		const String& name = L"",		/*  */
-		bool paused = false				/* Ƿͣ */
+		bool paused = false,			/* Ƿͣ */
+		UINT eventMask = EventMask::All	/* ¼ */
 	);
 
 	// ײ
@@ -440,6 +450,15 @@ protected:
 	// ¶ά任
 	void _updateTransform() const;
 
+	// ǽڵҪŰ棬ŰƳٵһȾȡߴʱ
+	void _invalidateLayout();
+
+	// ڵҪŰ棬Ű
+	void _updateLayout() const;
+
+	// Űڵݲýڵߴ
+	virtual void _rebuildLayout() {}
+
 	// ¶ά任
 	void _updateInverseTransform() const;
 
@@ -449,9 +468,24 @@ protected:
 	// ½ڵ͸
 	void _updateOpacity();
 
+	// жӦĽڵַ¼
+	void __dispatch(Event* evt, int index);
+
 	// ¼
 	void __updateListeners(Event* evt);
 
+	// ڵϵļ仯ʱиڵļ
+	void __updateListenerCount(
+		UINT eventMask,
+		int delta
+	);
+
+	// ӽڵӻƳʱиڵļ
+	void __updateListenerCount(
+		const Node * child,
+		int sign
+	);
+
 	// ռ
 	void __clearListeners();
 
@@ -473,6 +507,7 @@ protected:
 	float		_realOpacity;
 	float		_anchorX;
 	float		_anchorY;
+	float		_timeScale;
 	int			_nOrder;
 	String		_name;
 	size_t		_hashName;
@@ -481,7 +516,10 @@ protected:
 	
 	std::vector<Node*>	_children;
 	std::vector<Listener*> _listeners;
+	// м¼ļһΪԶ͵¼
+	int			_listenerCount[Event::Last + 2];
 
+	mutable bool		_dirtyLayout;
 	mutable bool		_dirtyTransform;
 	mutable Matrix32	_transform;
 	mutable bool		_dirtyInverseTransform;
@@ -771,10 +809,13 @@ public:
 	virtual void onRender() override;
 
 protected:
-	// Ű
+	// ҪŰ
 	void _reset();
 
-	// ָʽ
+	// Ű
+	virtual void _rebuildLayout() override;
+
+	// ȡָʽ
 	void _createFormat();
 
 	// ֲ
@@ -789,6 +830,65 @@ protected:
 };
 
 
+// λͼ
+// λͼеƴ֣޸ʱֻ¼λãʺƵ仯ķʱ
+class BitmapText :
+	public Node
+{
+public:
+	BitmapText();
+
+	explicit BitmapText(
+		BitmapFont * font,				/* λͼ */
+		const String& text = L""		/*  */
+	);
+
+	explicit BitmapText(
+		const String& fontFilePath,		/* ļ· */
+		const String& text = L""		/*  */
+	);
+
+	virtual ~BitmapText();
+
+	// ȡı
+	String getText() const;
+
+	// ȡλͼ
+	BitmapFont * getFont() const;
+
+	// ȡ뷽ʽ
+	Text::Align getAlignment() const;
+
+	// ı
+	void setText(
+		const String& text
+	);
+
+	// λͼ
+	void setFont(
+		BitmapFont * font
+	);
+
+	// öֵĶ뷽ʽĬΪ Align::Left
+	void setAlignment(
+		Text::Align align
+	);
+
+	// Ⱦ
+	virtual void onRender() override;
+
+protected:
+	// Ű
+	virtual void _rebuildLayout() override;
+
+protected:
+	String		_text;
+	Text::Align	_alignment;
+	BitmapFont *_font;
+	std::vector<BitmapFont::Quad> _quads;
+};
+
+
 class Button :
 	public Node
 {
@@ -10,6 +10,14 @@
 #	include <mmsystem.h>
 #endif
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <unordered_map>
+
 namespace easy2d
 {
 
@@ -57,11 +65,406 @@ private:
 };
 
 
+// Ƶ
+// ˳ PCM 
+class AudioDecoder
+{
+public:
+	virtual ~AudioDecoder() {}
+
+	// ȡ PCM ݣضȡֽ 0 ʾѶ
+	virtual UINT32 read(
+		BYTE * buffer,
+		UINT32 size
+	) = 0;
+
+	// صݿͷ
+	virtual bool rewind() = 0;
+};
+
+
+// Ƶ豸
+// ύ˳򲥷Żڲ֮ǰ뱣Ч
+class AudioOutput
+{
+public:
+	virtual ~AudioOutput() {}
+
+	// ύ
+	virtual bool submit(
+		const BYTE * data,
+		UINT32 size,
+		bool endOfStream		/* ǷΪһ */
+	) = 0;
+
+	// ȡύδĻ
+	virtual UINT32 getQueuedCount() = 0;
+
+	// ʼ
+	virtual bool start() = 0;
+
+	// ͣ
+	virtual void stop() = 0;
+
+	// ύĻ
+	virtual void flush() = 0;
+};
+
+
+// Ƶ豸
+// 趨ĻûƵ豸ĻкͲ
+class NullAudioOutput :
+	public AudioOutput
+{
+public:
+	explicit NullAudioOutput(
+		UINT32 bytesPerSecond = 0	/* ʣΪ 0 ʱύ */
+	);
+
+	virtual bool submit(
+		const BYTE * data,
+		UINT32 size,
+		bool endOfStream
+	) override;
+
+	virtual UINT32 getQueuedCount() override;
+
+	virtual bool start() override;
+
+	virtual void stop() override;
+
+	virtual void flush() override;
+
+	// ȡύĻ
+	UINT32 getSubmittedCount() const;
+
+	// ȡѲŵֽ
+	UINT64 getPlayedBytes() const;
+
+protected:
+	// ʱĻ
+	void _consume();
+
+protected:
+	UINT32	_bytesPerSecond;
+	bool	_started;
+	UINT32	_submittedCount;
+	UINT64	_playedBytes;
+	double	_pendingBytes;
+	std::deque<UINT32> _queue;
+	std::chrono::steady_clock::time_point _lastTime;
+};
+
+
+// ļ豸
+// ύ PCM д WAV ļ߻Ͳ
+class WaveFileOutput :
+	public AudioOutput
+{
+public:
+	WaveFileOutput(
+		const String& filePath,			/* ļ· */
+		const WAVEFORMATEX * format		/* Ƶʽ */
+	);
+
+	virtual ~WaveFileOutput();
+
+	virtual bool submit(
+		const BYTE * data,
+		UINT32 size,
+		bool endOfStream
+	) override;
+
+	virtual UINT32 getQueuedCount() override;
+
+	virtual bool start() override;
+
+	virtual void stop() override;
+
+	virtual void flush() override;
+
+	// ļǷѴ
+	bool isOpened() const;
+
+	// ȡд PCM ݴС
+	UINT32 getDataSize() const;
+
+protected:
+	// дļͷ
+	void _writeHeader();
+
+protected:
+	HANDLE				_file;
+	UINT32				_dataSize;
+	std::vector<BYTE>	_format;
+};
+
+
+// Ƶ
+// ں̨߳зֿ룬ͨѭʹõĻ豸ύݣ
+// ڴռֻ뻺СйأƵʱ޹
+class AudioStream
+{
+public:
+	AudioStream(
+		AudioDecoder * decoder,			/* Ƶͷ */
+		AudioOutput * output,			/* 豸Ƶͷ */
+		UINT32 bufferSize = 64 * 1024,	/* ÿĴС */
+		UINT32 bufferCount = 3			/*  */
+	);
+
+	~AudioStream();
+
+	// 
+	bool play(
+		int loopCount = 0	/* ظŴ -1 Ϊѭ */
+	);
+
+	// ͣ
+	void pause();
+
+	// 
+	void resume();
+
+	// ֹͣ
+	void stop();
+
+	// Ƿڲ
+	bool isPlaying() const;
+
+	// ǷͣҿԼ
+	bool isPaused();
+
+	// ֪ͨƵл
+	void notify();
+
+	// ȡռõڴ
+	size_t getMemoryUsage() const;
+
+private:
+	AudioStream(const AudioStream&);
+
+	AudioStream& operator=(const AudioStream&);
+
+	// ̨߳
+	void _run();
+
+	// 豸仺
+	void _pump();
+
+private:
+	AudioDecoder *		_decoder;
+	AudioOutput *		_output;
+	UINT32				_bufferSize;
+	UINT32				_bufferCount;
+	UINT32				_nextBuffer;
+	int					_loopCount;
+	bool				_ended;
+	std::vector<BYTE>	_ring;
+	std::atomic<bool>	_playing;
+	std::atomic<bool>	_signaled;
+	bool				_quit;
+	std::mutex			_mutex;
+	std::condition_variable _cond;
+	std::thread			_thread;
+};
+
+
+// ֻļӳ
+// ļӳ䵽ڴ棬ӳ close ǰЧ
+class FileMapping
+{
+public:
+	FileMapping();
+
+	~FileMapping();
+
+	// ӳļļ޷ӳ
+	bool open(
+		const String& filePath	/* ļ· */
+	);
+
+	// ӳ䲢رļ
+	void close();
+
+	// Ƿӳ
+	bool isOpened() const;
+
+	// ȡӳ
+	const BYTE * getData() const;
+
+	// ȡļС
+	size_t getSize() const;
+
+	// ӳ
+	void swap(
+		FileMapping& other
+	);
+
+private:
+	FileMapping(const FileMapping&);
+
+	FileMapping& operator=(const FileMapping&);
+
+private:
+	HANDLE	_file;
+	HANDLE	_mapping;
+	LPVOID	_view;
+	size_t	_size;
+};
+
+
+// 
+// ֱӽ RIFF/WAVE ݣPCM8/16/24/32 λ 32 λʽĲ
+// ֱļӳԴڴ棬ƣIMA ADPCM Ϊ 16 λ PCM
+class WaveFile
+{
+	friend class Music;
+
+public:
+	WaveFile();
+
+	~WaveFile();
+
+	// ڴӳ䷽ʽ WAV ļֵ֧ı뷵 false
+	bool open(
+		const String& filePath		/* ļ· */
+	);
+
+	// ڴе WAV ݣֱøڴ棬ʹڼ뱣Ч
+	// ԴʱøԴжغӳԱ close
+	bool parse(
+		const void * buffer,
+		size_t size
+	);
+
+	// رղԴ
+	void close();
+
+	// ǷЧ
+	bool isValid() const;
+
+	// ǷֱļԴڴ
+	bool isInPlace() const;
+
+	// ȡƵʽ
+	const WAVEFORMATEX * getFormat() const;
+
+	// ȡ
+	const BYTE * getData() const;
+
+	// ȡݴС
+	UINT32 getDataSize() const;
+
+	// ȡʱ룩
+	float getDuration() const;
+
+private:
+	WaveFile(const WaveFile&);
+
+	WaveFile& operator=(const WaveFile&);
+
+	// ӹʹ new[] Ĳ
+	void _assign(
+		BYTE * data,
+		UINT32 size,
+		const WAVEFORMATEX * format
+	);
+
+	// ݲ
+	void _swap(
+		WaveFile& other
+	);
+
+	//  IMA ADPCM ݽΪ 16 λ PCM
+	bool _decodeImaAdpcm(
+		const BYTE * data,
+		UINT32 size,
+		const WAVEFORMATEX * format,
+		UINT32 samplesPerBlock
+	);
+
+private:
+	std::vector<BYTE>	_format;
+	const BYTE *		_data;
+	UINT32				_dataSize;
+	BYTE *				_buffer;
+	FileMapping			_mapping;
+	const void *		_package;
+};
+
+
+// Ч
+// Ч˴ͬһʱֻһЧ
+class SoundVoice
+{
+public:
+	virtual ~SoundVoice() {}
+
+	//  PCM ݣڲŽǰ뱣Ч
+	virtual bool play(
+		const BYTE * data,
+		UINT32 size,
+		int loopCount		/* ظŴ -1 Ϊѭ */
+	) = 0;
+
+	// ֹͣ
+	virtual void stop() = 0;
+
+	// Ƿڲ
+	virtual bool isPlaying() = 0;
+
+	// 
+	virtual void setVolume(
+		float volume
+	) = 0;
+};
+
+
+// Ч
+class SoundBackend
+{
+public:
+	virtual ~SoundBackend() {}
+
+	// ָʽʧʱ nullptr
+	virtual SoundVoice * createVoice(
+		const WAVEFORMATEX * format
+	) = 0;
+};
+
+
+// Ч
+// Ƶʽʼ㲥ʱûƵ豸ĻкͲ
+class NullSoundBackend :
+	public SoundBackend
+{
+public:
+	explicit NullSoundBackend(
+		bool realTime = true	/* Ϊ false ʱһֱţֱֹͣ */
+	);
+
+	virtual SoundVoice * createVoice(
+		const WAVEFORMATEX * format
+	) override;
+
+	// ȡѴ
+	UINT32 getVoiceCount() const;
+
+protected:
+	bool	_realTime;
+	UINT32	_voiceCount;
+};
+
+
 // 
 class Music :
 	public Object
 {
 	friend class Game;
+	friend class Sound;
+	friend class SoundPool;
+	friend class AudioMixer;
 
 public:
 	Music();
@@ -108,16 +511,51 @@ public:
 	// Ƿڲ
 	bool isPlaying() const;
 
+	// ǷͣҿԼ
+	bool isPaused() const;
+
 	// 
 	bool setVolume(
 		float volume
 	);
 
+	// ǷΪʽ
+	bool isStreaming() const;
+
+	// ȡƵռõڴ
+	size_t getMemoryUsage() const;
+
+	// ʽŵʱֵʱļ߽߲ţΪʱرʽ
+	static void setStreamingThreshold(
+		float seconds	/* ʱֵ룩ĬΪ 10  */
+	);
+
 private:
 	static bool __init();
 
 	static void __uninit();
 
+	// Ƶļ
+	static bool __decode(
+		const String& filePath,
+		WaveFile& wave
+	);
+
+	// ƵԴ
+	static bool __decode(
+		int resNameId,
+		const String& resType,
+		WaveFile& wave
+	);
+
+	// ĬϵЧˣ֧ʱ nullptr
+	static SoundBackend * __createSoundBackend();
+
+	// ĬƵ豸֧ʱ nullptr
+	static AudioOutput * __createAudioOutput(
+		const WAVEFORMATEX * format
+	);
+
 #ifndef E2D_USE_MCI
 	HRESULT _loadMediaFile(
 		String const& file_path
@@ -132,13 +570,24 @@ private:
 		IMFSourceReader* reader
 	);
 
+	// ýʽȡ WAVEFORMAT
+	HRESULT _initSource(
+		IMFSourceReader* reader
+	);
+
+	// ʽŴļʱδֵʱ S_FALSE
+	HRESULT _openStream(
+		String const& file_path
+	);
+
 protected:
 	bool _opened;
 	mutable bool _playing;
-	BYTE* _waveData;
-	DWORD _waveDataSize;
+	WaveFile _wave;
 	WAVEFORMATEX* _wfx;
 	IXAudio2SourceVoice* _voice;
+	IXAudio2VoiceCallback* _callback;
+	AudioStream* _stream;
 
 #else
 
@@ -163,7 +612,20 @@ class MusicPlayer
 	friend class Game;
 
 public:
+	// ֻͳ
+	struct CacheStats
+	{
+		UINT32 hits;			/* д */
+		UINT32 misses;			/* δУ¼أ */
+		UINT32 evictions;		/* մ */
+		UINT32 count;			/*  */
+		size_t bytes;			/* ռõڴ */
+		size_t budget;			/* ڴԤ */
+	};
+
 	// ԤԴ
+	// صֹ鲥УԤʱܱգ
+	// ҪڳʱӦ GC::retainڼ䲻ᱻգʹʱ GC::release
 	static Music* preload(
 		const String& filePath	/* ļ· */
 	);
@@ -194,7 +656,7 @@ public:
 		const String& filePath	/* ļ· */
 	);
 
-	// ԤԴ
+	// ԤԴصͬҪ GC::retain ܳڳ
 	static Music* preload(
 		int resNameId,			/* Դ */
 		const String& resType	/* Դ */
@@ -248,11 +710,289 @@ public:
 	// ֹͣ
 	static void stopAll();
 
+	// ֻڴԤ㣬ʱδʹδڲŵ
+	static void setCacheBudget(
+		size_t bytes			/* ڴԤ㣨ֽڣΪ 0 ʱƣĬΪ 64 MB */
+	);
+
+	// տеֱ֣治ڴԤ
+	static void trimCache();
+
+	// ȡֻͳ
+	static CacheStats getCacheStats();
+
+	// ûͳƼ
+	static void resetCacheStats();
+
 private:
 	static void __uninit();
 };
 
 
+// Ч
+// ƵֻһݣЧеţͬʱŶ
+class Sound :
+	public Object
+{
+public:
+	Sound();
+
+	explicit Sound(
+		const String& filePath		/* Чļ· */
+	);
+
+	Sound(
+		int resNameId,				/* ЧԴ */
+		const String& resType		/* ЧԴ */
+	);
+
+	virtual ~Sound();
+
+	// Чļ
+	bool open(
+		const String& filePath		/* Чļ· */
+	);
+
+	// ЧԴ
+	bool open(
+		int resNameId,				/* ЧԴ */
+		const String& resType		/* ЧԴ */
+	);
+
+	// ţʹЧеĿ
+	bool play(
+		int priority = 0,			/* ȼʱֹͣȼЧ */
+		float volume = 1.f,			/*  */
+		int loopCount = 0			/* ظŴ -1 Ϊѭ */
+	);
+
+	// ֹͣЧв
+	void stop();
+
+	// رղԴ
+	void close();
+
+	// ǷѴ
+	bool isOpened() const;
+
+	// ȡƵʽ
+	const WAVEFORMATEX * getFormat() const;
+
+	// ȡ PCM 
+	const BYTE * getData() const;
+
+	// ȡ PCM ݴС
+	UINT32 getDataSize() const;
+
+	// ȡʱ룩
+	float getDuration() const;
+
+protected:
+	WaveFile _wave;
+};
+
+
+// Ч
+// ΪÿƵʽԤȴһЧʱȡÿ
+// ʱȼռڲŵ
+class SoundPool
+{
+	friend class Game;
+
+public:
+	// Чͳ
+	struct Stats
+	{
+		UINT32 formatCount;		/* Ƶʽ */
+		UINT32 voiceCount;		/*  */
+		UINT32 activeCount;		/* ڲŵ */
+		UINT32 playCount;		/* Ŵ */
+		UINT32 stolenCount;		/* ռ */
+		UINT32 droppedCount;	/* δܲŵĴ */
+	};
+
+	// Ч
+	static bool play(
+		Sound * sound,			/* Ч */
+		int priority = 0,		/* ȼ */
+		float volume = 1.f,		/*  */
+		int loopCount = 0		/* ظŴ -1 Ϊѭ */
+	);
+
+	// ֹͣЧв
+	static void stop(
+		Sound * sound
+	);
+
+	// ֹͣЧ
+	static void stopAll();
+
+	// ΪЧĸʽԤȴ
+	static bool prepare(
+		Sound * sound
+	);
+
+	// ÿƵʽֻ֮½ĸʽЧ
+	static void setVoiceCount(
+		int count				/* ĬΪ 8 */
+	);
+
+	// ȡ
+	static float getVolume();
+
+	// 
+	static void setVolume(
+		float volume
+	);
+
+	// ЧˣЧظͷţ nullptr ʱʹĬϺ
+	// ˻ֹͣ
+	static void setBackend(
+		SoundBackend * backend
+	);
+
+	// ȡЧͳƣıͼ
+	static Stats getStats();
+
+	// òšռͶļ
+	static void resetStats();
+
+private:
+	// ȡЧˣδʱĬϺ
+	static SoundBackend * __getBackend();
+
+	static void __uninit();
+};
+
+
+// 
+// ڽЧΪһ· 16 λ PCM֧ͱ
+// ֻռһ豸豸ĺ̨߳нУ෽̵߳
+class AudioMixer
+{
+	friend class Game;
+	friend class Sound;
+
+public:
+	explicit AudioMixer(
+		UINT32 sampleRate = 44100	/*  */
+	);
+
+	~AudioMixer();
+
+	// Чţʧʱ -1
+	// ЧΪ 16 λ PCM
+	int play(
+		Sound * sound,				/* Ч */
+		float volume = 1.f,			/*  */
+		float pan = 0.f,			/* -1 Ϊ1 Ϊ */
+		float pitch = 1.f,			/* ߣʣ*/
+		int loopCount = 0			/* ظŴ -1 Ϊѭ */
+	);
+
+	// ֹͣ
+	void stop(
+		int id
+	);
+
+	// ֹͣ
+	void stopAll();
+
+	// Ƿڲ
+	bool isPlaying(
+		int id
+	);
+
+	// 
+	void setVolume(
+		int id,
+		float volume
+	);
+
+	// 
+	void setPan(
+		int id,
+		float pan
+	);
+
+	// 
+	void setPitch(
+		int id,
+		float pitch
+	);
+
+	// 
+	void setMasterVolume(
+		float volume
+	);
+
+	// ȡ
+	float getMasterVolume() const;
+
+	// ȡڲŵ
+	UINT32 getActiveCount();
+
+	// д뻺дֽ
+	UINT32 render(
+		BYTE * buffer,
+		UINT32 size
+	);
+
+	// ʼ豸ύ
+	bool start(
+		AudioOutput * output = nullptr,	/* 豸ɻͷţΪ nullptr ʱʹĬƵ豸 */
+		UINT32 bufferFrames = 1024		/* ÿ֡ */
+	);
+
+	// ֹͣ豸ύͷ豸
+	void shutdown();
+
+	// ȡʽ
+	const WAVEFORMATEX * getFormat() const;
+
+private:
+	AudioMixer(const AudioMixer&);
+
+	AudioMixer& operator=(const AudioMixer&);
+
+	// ͷѲϵ
+	void _collect();
+
+	// лѲϵ
+	static void __update();
+
+	// ֹͣлʹøЧЧһ֡
+	static void __stop(
+		Sound * sound
+	);
+
+private:
+	struct Voice
+	{
+		int			id;
+		Sound *		sound;
+		const short * samples;
+		UINT32		frameCount;
+		UINT32		channels;
+		double		position;
+		double		rate;		/* Ч֮ */
+		float		volume;
+		float		pan;
+		float		pitch;
+		int			loopCount;
+		bool		finished;
+	};
+
+	WAVEFORMATEX		_format;
+	float				_masterVolume;
+	int					_nextId;
+	std::vector<Voice>	_voices;
+	std::vector<float>	_mixBuffer;
+	std::mutex			_mutex;
+	AudioStream *		_stream;
+};
+
+
 // ʱ
 class Timer
 {
@@ -306,7 +1046,9 @@ public:
 
 private:
 	// ¶ʱ
-	static void __update();
+	static void __update(
+		float dt
+	);
 
 	// öʱ״̬
 	static void __resetAll();
@@ -317,8 +1059,13 @@ private:
 
 
 // ݹ
+// ݴȡ
+// ״ʹʱļڴ棬дֻڴ棻޸Ĺɺ̨߳
+// ڻ flush ʱдأдʱļ滻ԭļдʧʱ޸ģһ
 class Data
 {
+	friend class Game;
+
 public:
 	//  int ͵ֵ
 	static void saveInt(
@@ -379,6 +1126,260 @@ public:
 		const String& defaultValue,			/* Ĭֵ */
 		const String& field = L"Defalut"	/* ֶ */
 	);
+
+	// ޸Ĺдش
+	static void flush(
+		bool wait = false	/* Ƿȴддʧʱͬأͨ isDirty ж */
+	);
+
+	// Զдصļ룩Ϊ 0 ʱֻ flush Ϸʱд
+	static void setFlushInterval(
+		float seconds
+	);
+
+	// Ƿδдص޸
+	static bool isDirty();
+
+private:
+	// дݲ̨߳
+	static void __uninit();
+};
+
+
+// 浵ֶ
+struct SaveFieldType
+{
+	enum Value : UINT16
+	{
+		Unknown = 0,
+		Int,			/* 32 λ */
+		Int64,			/* 64 λ */
+		Float,			/* ȸ */
+		Double,			/* ˫ȸ */
+		String,			/* ַ */
+		Blob,			/*  */
+		IntArray,		/* 32 λ */
+		FloatArray		/* ȸ */
+	};
+};
+
+
+// ƴ浵д
+// ֶΰƱ棬ļͷ¼浵ṹİ汾źݵ CRC32 Уͣ
+// ݺ鰴 8 ֽڶţȡʱֱļӳ
+class SaveWriter
+{
+public:
+	SaveWriter(
+		UINT32 schemaVersion = 1	/* 浵ṹİ汾 */
+	);
+
+	//  32 λ
+	void setInt(
+		const String& name,
+		int value
+	);
+
+	//  64 λ
+	void setInt64(
+		const String& name,
+		INT64 value
+	);
+
+	// 浥ȸ
+	void setFloat(
+		const String& name,
+		float value
+	);
+
+	// ˫ȸ
+	void setDouble(
+		const String& name,
+		double value
+	);
+
+	// ַ
+	void setString(
+		const String& name,
+		const String& value
+	);
+
+	// 
+	void setBlob(
+		const String& name,
+		const void * data,
+		UINT32 size
+	);
+
+	//  32 λ
+	void setIntArray(
+		const String& name,
+		const int * values,
+		UINT32 count
+	);
+
+	// 浥ȸ
+	void setFloatArray(
+		const String& name,
+		const float * values,
+		UINT32 count
+	);
+
+	// ֶ
+	void clear();
+
+	// ȡֶ
+	UINT32 getCount() const;
+
+	// дļдʱļ滻ԭļ
+	bool save(
+		const String& filePath
+	) const;
+
+	// дڴ
+	void save(
+		std::vector<BYTE>& buffer
+	) const;
+
+private:
+	// ֶݣֶͬλᱻ滻
+	void _set(
+		const String& name,
+		SaveFieldType::Value type,
+		const void * data,
+		UINT32 size
+	);
+
+private:
+	struct Field
+	{
+		String name;
+		UINT16 type;
+		size_t offset;		/*  _data еλ */
+		UINT32 size;
+		UINT32 capacity;	/* ռõĿռ䣬дʱԭظ */
+	};
+
+	UINT32				_schemaVersion;
+	std::vector<BYTE>	_data;
+	std::vector<Field>	_fields;
+	std::unordered_map<String, size_t> _index;
+};
+
+
+// ƴ浵ȡ
+// ʱӳļУ飬ݺֱӷļӳеĵַ
+//  close ǰЧ
+class SaveReader
+{
+public:
+	SaveReader();
+
+	~SaveReader();
+
+	// 򿪴浵ļ
+	bool open(
+		const String& filePath,	/* ļ· */
+		bool verify = true		/* ǷУ */
+	);
+
+	// ڴеĴ浵ݣݲᱻƣҪ close ǰЧ
+	bool parse(
+		const void * buffer,
+		size_t size,
+		bool verify = true
+	);
+
+	// رմ浵
+	void close();
+
+	// ǷѴ
+	bool isOpened() const;
+
+	// ȡ浵ṹİ汾
+	UINT32 getSchemaVersion() const;
+
+	// ȡֶ
+	UINT32 getCount() const;
+
+	// Ƿֶ
+	bool contains(
+		const String& name
+	) const;
+
+	// ȡֶ
+	SaveFieldType::Value getType(
+		const String& name
+	) const;
+
+	// ȡ 32 λ
+	int getInt(
+		const String& name,
+		int defaultValue = 0
+	) const;
+
+	// ȡ 64 λ
+	INT64 getInt64(
+		const String& name,
+		INT64 defaultValue = 0
+	) const;
+
+	// ȡȸ
+	float getFloat(
+		const String& name,
+		float defaultValue = 0
+	) const;
+
+	// ȡ˫ȸ
+	double getDouble(
+		const String& name,
+		double defaultValue = 0
+	) const;
+
+	// ȡַ
+	String getString(
+		const String& name,
+		const String& defaultValue = L""
+	) const;
+
+	// ȡݣʱ nullptr
+	const void * getBlob(
+		const String& name,
+		UINT32 * size
+	) const;
+
+	// ȡ 32 λ飬ʱ nullptr
+	const int * getIntArray(
+		const String& name,
+		UINT32 * count
+	) const;
+
+	// ȡȸ飬ʱ nullptr
+	const float * getFloatArray(
+		const String& name,
+		UINT32 * count
+	) const;
+
+private:
+	SaveReader(const SaveReader&);
+
+	SaveReader& operator=(const SaveReader&);
+
+	// ֶΣֶ
+	const BYTE * _find(
+		const String& name,
+		SaveFieldType::Value * type,
+		UINT32 * size
+	) const;
+
+private:
+	const BYTE *	_base;
+	size_t			_size;
+	const BYTE *	_entries;
+	const BYTE *	_names;
+	UINT32			_count;
+	UINT32			_schemaVersion;
+	FileMapping		_mapping;
 };
 
 
@@ -387,6 +1388,16 @@ class Path
 {
 	friend class Game;
 
+public:
+	// ļͳ
+	struct SearchStats
+	{
+		unsigned int	lookups;	/*  */
+		unsigned int	cacheHits;	/* лĴ */
+		unsigned int	indexBuilds;/* Ŀ¼Ĵ */
+		float			totalTime;	/* ܺʱ룩 */
+	};
+
 public:
 	// ·
 	static void add(
@@ -394,10 +1405,17 @@ public:
 	);
 
 	// ļ·
+	// ÿ·״μʱĿ¼δҵᱻ
 	static String searchForFile(
 		const String& path
 	);
 
+	// ļĿ¼ļɾ
+	static void clearSearchCache();
+
+	// ȡļͳ
+	static SearchStats getSearchStats();
+
 	// ȡԴļȡļ·
 	static String extractResource(
 		int resNameId,				/* Դ */
@@ -430,6 +1448,13 @@ public:
 		const String& dirPath	/* ļ· */
 	);
 
+	// дļдʱļ滻ԭļд;ʧܲԭ
+	static bool writeFileAtomic(
+		const String& filePath,		/* ļ· */
+		const void * data,			/* ļ */
+		size_t size					/* ļС */
+	);
+
 private:
 	// ʼ
 	static bool __init(
@@ -437,4 +1462,58 @@ private:
 	);
 };
 
+
+// Դ
+// СļϲΪһļͨڴӳ򿪣ƹϣֲҡ
+// غ Image  Music ȴԴмͬļ
+// ر˵⣬̵߳
+class Package
+{
+	friend class Game;
+
+public:
+	// Դ
+	static bool mount(
+		const String& filePath	/* Դļ· */
+	);
+
+	// жԴ
+	// ֮ find صȫʧЧԱ retain õԴӳ䣬
+	// ֱһͷ
+	static void unmountAll();
+
+	// жԴǷļ
+	static bool contains(
+		const String& fileName	/* ļڴʱļУ */
+	);
+
+	// ȡԴļݣԴжǰЧ
+	// жغʹʱȵ retain
+	static Resource::Data find(
+		const String& fileName	/* ļڴʱļУ */
+	);
+
+	//  find صݣʹڵԴжغԱӳ䣬
+	// ַκѹصԴʱ false
+	static bool retain(
+		const void* buffer		/* find صݵַ */
+	);
+
+	// ͷ retain ӵ
+	static void release(
+		const void* buffer		/* find صݵַ */
+	);
+
+	// ļеļΪԴ
+	static bool build(
+		const String& dirPath,		/* ļ· */
+		const String& outFilePath,	/* Դļ· */
+		bool compress = true		/* Ƿѹļ */
+	);
+
+private:
+	// Դ
+	static void __uninit();
+};
+
 }
\ No newline at end of file
@@ -5,8 +5,9 @@ easy2d::Action::Action()
 	: _running(false)
 	, _done(false)
 	, _initialized(false)
+	, _tweening(false)
 	, _target(nullptr)
-	, _last(0)
+	, _elapsed(0)
 {
 }
 
@@ -22,7 +23,6 @@ bool easy2d::Action::isRunning()
 void easy2d::Action::resume()
 {
 	_running = true;
-	_last = Time::getTotalTime();
 }
 
 void easy2d::Action::pause()
@@ -54,7 +54,7 @@ void easy2d::Action::reset()
 {
 	_initialized = false;
 	_done = false;
-	_last = Time::getTotalTime();
+	_elapsed = 0;
 }
 
 bool easy2d::Action::_isDone()
@@ -72,15 +72,19 @@ void easy2d::Action::_startWithTarget(Node* target)
 void easy2d::Action::_init()
 {
 	_initialized = true;
-	_last = Time::getTotalTime();
+	_elapsed = 0;
 }
 
-void easy2d::Action::_update()
+void easy2d::Action::_update(float dt)
 {
 	if (!_initialized)
 	{
 		_init();
 	}
+	else
+	{
+		_elapsed += dt;
+	}
 }
 
 void easy2d::Action::_resetTime()
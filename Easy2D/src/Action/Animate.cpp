@@ -46,9 +46,9 @@ void easy2d::Animate::_init()
 	}
 }
 
-void easy2d::Animate::_update()
+void easy2d::Animate::_update(float dt)
 {
-	Action::_update();
+	Action::_update(dt);
 
 	if (!_animation)
 	{
@@ -56,7 +56,7 @@ void easy2d::Animate::_update()
 		return;
 	}
 
-	while ((Time::getTotalTime() - _last) >= _animation->getInterval())
+	while (_elapsed >= _animation->getInterval())
 	{
 		auto& frames = _animation->getFrames();
 		auto target = dynamic_cast<Sprite*>(_target);
@@ -66,7 +66,7 @@ void easy2d::Animate::_update()
 			target->open(frames[_frameIndex]);
 		}
 
-		_last += _animation->getInterval();
+		_elapsed -= _animation->getInterval();
 		++_frameIndex;
 
 		if (_frameIndex == frames.size())
@@ -77,12 +77,6 @@ void easy2d::Animate::_update()
 	}
 }
 
-void easy2d::Animate::_resetTime()
-{
-	Action::_resetTime();
-	_last = Time::getTotalTime();
-}
-
 void easy2d::Animate::reset()
 {
 	Action::reset();
@@ -19,7 +19,7 @@ void easy2d::CallFunc::_init()
 {
 }
 
-void easy2d::CallFunc::_update()
+void easy2d::CallFunc::_update(float dt)
 {
 	_func();
 	this->stop();
@@ -27,20 +27,14 @@ void easy2d::Delay::_init()
 	Action::_init();
 }
 
-void easy2d::Delay::_update()
+void easy2d::Delay::_update(float dt)
 {
-	Action::_update();
+	Action::_update(dt);
 
-	_delta = Time::getTotalTime() - _last;
+	_delta = _elapsed;
 
 	if (_delta >= _delay)
 	{
 		this->stop();
 	}
 }
-
-void easy2d::Delay::_resetTime()
-{
-	Action::_resetTime();
-	_last = Time::getTotalTime() - _delta;
-}
@@ -0,0 +1,79 @@
+#include <easy2d/e2daction.h>
+
+easy2d::Ease::Type easy2d::Ease::reverse(Type type)
+{
+	switch (type)
+	{
+	case Type::QuadIn:		return Type::QuadOut;
+	case Type::QuadOut:		return Type::QuadIn;
+	case Type::CubicIn:		return Type::CubicOut;
+	case Type::CubicOut:	return Type::CubicIn;
+	case Type::SineIn:		return Type::SineOut;
+	case Type::SineOut:		return Type::SineIn;
+	case Type::BackIn:		return Type::BackOut;
+	case Type::BackOut:		return Type::BackIn;
+	case Type::ElasticIn:	return Type::ElasticOut;
+	case Type::ElasticOut:	return Type::ElasticIn;
+	case Type::BounceIn:	return Type::BounceOut;
+	case Type::BounceOut:	return Type::BounceIn;
+	default:				return type;
+	}
+}
+
+easy2d::Ease::Func easy2d::Ease::reverse(const Func& func)
+{
+	if (!func)
+	{
+		return nullptr;
+	}
+
+	// ʱ f'(t) = 1 - f(1 - t)
+	return [func](float t) { return 1 - func(1 - t); };
+}
+
+easy2d::Ease::Func easy2d::Ease::bezier(float x1, float y1, float x2, float y2)
+{
+	// ߵĶʽϵP0 = (0, 0)P3 = (1, 1)
+	const float cx = 3 * x1;
+	const float bx = 3 * (x2 - x1) - cx;
+	const float ax = 1 - cx - bx;
+	const float cy = 3 * y1;
+	const float by = 3 * (y2 - y1) - cy;
+	const float ay = 1 - cy - by;
+
+	return [=](float t) -> float
+	{
+		if (t <= 0 || t >= 1)
+			return t;
+
+		// ţٵ x(s) = t
+		float s = t;
+		for (int i = 0; i < 8; ++i)
+		{
+			float x = ((ax * s + bx) * s + cx) * s - t;
+			if (math::Abs(x) < 1e-6f)
+				return ((ay * s + by) * s + cy) * s;
+
+			float dx = (3 * ax * s + 2 * bx) * s + cx;
+			if (math::Abs(dx) < 1e-6f)
+				break;
+
+			s -= x / dx;
+		}
+
+		// Сʱöַ
+		float lo = 0, hi = 1;
+		s = t;
+		for (int i = 0; i < 32; ++i)
+		{
+			float x = ((ax * s + bx) * s + cx) * s;
+			if (math::Abs(x - t) < 1e-6f)
+				break;
+
+			if (x < t) lo = s;
+			else hi = s;
+			s = (lo + hi) / 2;
+		}
+		return ((ay * s + by) * s + cy) * s;
+	};
+}
@@ -2,14 +2,92 @@
 
 easy2d::FiniteTimeAction::FiniteTimeAction(float duration)
 	: _delta(0)
+	, _progress(0)
 	, _duration(max(duration, 0))
+	, _easeType(Ease::Type::Linear)
+	, _easeFunc(nullptr)
+	, _tweenable(false)
+	, _tweenIndex(-1)
+	, _tweenProperty(TweenManager::Property::Position)
 {
 }
 
+easy2d::FiniteTimeAction::~FiniteTimeAction()
+{
+	TweenManager::__remove(this);
+}
+
+void easy2d::FiniteTimeAction::resume()
+{
+	Action::resume();
+	TweenManager::__setPaused(this, false);
+}
+
+void easy2d::FiniteTimeAction::pause()
+{
+	Action::pause();
+	TweenManager::__setPaused(this, true);
+}
+
+void easy2d::FiniteTimeAction::stop()
+{
+	Action::stop();
+	TweenManager::__remove(this);
+	_tweenable = false;
+}
+
 void easy2d::FiniteTimeAction::reset()
 {
+	TweenManager::__remove(this);
 	Action::reset();
 	_delta = 0;
+	_progress = 0;
+}
+
+void easy2d::FiniteTimeAction::setEase(Ease::Type type)
+{
+	if (type == Ease::Type::Custom)
+	{
+		E2D_WARNING(L"Use setEase(Ease::Func) to set a custom ease function");
+		return;
+	}
+
+	_easeType = type;
+	_easeFunc = nullptr;
+}
+
+void easy2d::FiniteTimeAction::setEase(const Ease::Func& func)
+{
+	if (func)
+	{
+		_easeType = Ease::Type::Custom;
+		_easeFunc = func;
+	}
+	else
+	{
+		_easeType = Ease::Type::Linear;
+		_easeFunc = nullptr;
+	}
+}
+
+easy2d::Ease::Type easy2d::FiniteTimeAction::getEaseType() const
+{
+	return _easeType;
+}
+
+void easy2d::FiniteTimeAction::_copyEase(FiniteTimeAction * action, bool reversed) const
+{
+	if (action == nullptr)
+		return;
+
+	if (_easeFunc)
+	{
+		action->setEase(reversed ? Ease::reverse(_easeFunc) : _easeFunc);
+	}
+	else
+	{
+		action->setEase(reversed ? Ease::reverse(_easeType) : _easeType);
+	}
 }
 
 void easy2d::FiniteTimeAction::_init()
@@ -17,28 +95,60 @@ void easy2d::FiniteTimeAction::_init()
 	Action::_init();
 }
 
-void easy2d::FiniteTimeAction::_update()
+void easy2d::FiniteTimeAction::_update(float dt)
 {
-	Action::_update();
+	Action::_update(dt);
 
 	if (_duration == 0)
 	{
-		_delta = 1;
+		_progress = _delta = 1;
 		this->stop();
 	}
 	else
 	{
-		_delta = min((Time::getTotalTime() - _last) / _duration, 1);
+		_progress = min(_elapsed / _duration, 1);
 
-		if (_delta >= 1)
+		if (_progress >= 1)
 		{
+			_delta = 1;
 			this->stop();
 		}
+		else if (_easeFunc)
+		{
+			_delta = _easeFunc(_progress);
+		}
+		else
+		{
+			_delta = Ease::apply(_easeType, _progress);
+		}
+	}
+
+	// ֡ɲ
+	if (_tweenable && !_tweening && !_done)
+	{
+		this->_startTween();
 	}
 }
 
-void easy2d::FiniteTimeAction::_resetTime()
+void easy2d::FiniteTimeAction::_startWithTarget(Node* target)
+{
+	Action::_startWithTarget(target);
+	// ֱֻ ActionManager ִеĶ£
+	// Ϊ SequenceSpawnLoop Ӷʱɸ
+	_tweenable = true;
+}
+
+bool easy2d::FiniteTimeAction::_startTween()
+{
+	return false;
+}
+
+bool easy2d::FiniteTimeAction::_addTween(TweenManager::Property prop, float startX, float startY, float deltaX, float deltaY, float height, int jumps)
+{
+	return TweenManager::__add(this, prop, startX, startY, deltaX, deltaY, height, jumps);
+}
+
+bool easy2d::FiniteTimeAction::_getTweenParams(Node* target, TweenParams& params) const
 {
-	Action::_resetTime();
-	_last = Time::getTotalTime() - _delta * _duration;
+	return false;
 }
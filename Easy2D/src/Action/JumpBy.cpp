@@ -11,12 +11,16 @@ easy2d::JumpBy::JumpBy(float duration, const Vector2 & vec, float height, int ju
 
 easy2d::JumpBy * easy2d::JumpBy::clone() const
 {
-	return gcnew JumpBy(_duration, _deltaPos, _height, _jumps);
+	auto action = gcnew JumpBy(_duration, _deltaPos, _height, _jumps);
+	_copyEase(action, false);
+	return action;
 }
 
 easy2d::JumpBy * easy2d::JumpBy::reverse() const
 {
-	return gcnew JumpBy(_duration, -_deltaPos, _height, _jumps);
+	auto action = gcnew JumpBy(_duration, -_deltaPos, _height, _jumps);
+	_copyEase(action, true);
+	return action;
 }
 
 void easy2d::JumpBy::_init()
@@ -29,9 +33,9 @@ void easy2d::JumpBy::_init()
 	}
 }
 
-void easy2d::JumpBy::_update()
+void easy2d::JumpBy::_update(float dt)
 {
-	FiniteTimeAction::_update();
+	FiniteTimeAction::_update(dt);
 
 	if (_target)
 	{
@@ -51,3 +55,24 @@ void easy2d::JumpBy::_update()
 		_prevPos = newPos;
 	}
 }
+
+bool easy2d::JumpBy::_startTween()
+{
+	if (_target)
+	{
+		return _addTween(TweenManager::Property::Jump, _startPos.x, _startPos.y, _deltaPos.x, _deltaPos.y, _height, _jumps);
+	}
+	return false;
+}
+
+bool easy2d::JumpBy::_getTweenParams(Node* target, TweenParams& params) const
+{
+	params.prop = TweenManager::Property::Jump;
+	params.startX = target->getPosX();
+	params.startY = target->getPosY();
+	params.deltaX = _deltaPos.x;
+	params.deltaY = _deltaPos.y;
+	params.height = _height;
+	params.jumps = _jumps;
+	return true;
+}
@@ -9,7 +9,9 @@ easy2d::JumpTo::JumpTo(float duration, const Point & pos, float height, int jump
 
 easy2d::JumpTo * easy2d::JumpTo::clone() const
 {
-	return gcnew JumpTo(_duration, _endPos, _height, _jumps);
+	auto action = gcnew JumpTo(_duration, _endPos, _height, _jumps);
+	_copyEase(action, false);
+	return action;
 }
 
 void easy2d::JumpTo::_init()
@@ -17,3 +19,11 @@ void easy2d::JumpTo::_init()
 	JumpBy::_init();
 	_deltaPos = _endPos - _startPos;
 }
+
+bool easy2d::JumpTo::_getTweenParams(Node* target, TweenParams& params) const
+{
+	JumpBy::_getTweenParams(target, params);
+	params.deltaX = _endPos.x - params.startX;
+	params.deltaY = _endPos.y - params.startY;
+	return true;
+}
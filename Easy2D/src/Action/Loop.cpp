@@ -55,9 +55,9 @@ void easy2d::Loop::_init()
 	}
 }
 
-void easy2d::Loop::_update()
+void easy2d::Loop::_update(float dt)
 {
-	Action::_update();
+	Action::_update(dt);
 
 	if (_times == _totalTimes)
 	{
@@ -67,7 +67,7 @@ void easy2d::Loop::_update()
 
 	if (_action)
 	{
-		_action->_update();
+		_action->_update(dt);
 
 		if (_action->_isDone())
 		{
@@ -18,9 +18,9 @@ void easy2d::MoveBy::_init()
 	}
 }
 
-void easy2d::MoveBy::_update()
+void easy2d::MoveBy::_update(float dt)
 {
-	FiniteTimeAction::_update();
+	FiniteTimeAction::_update(dt);
 
 	if (_target)
 	{
@@ -35,12 +35,37 @@ void easy2d::MoveBy::_update()
 	}
 }
 
+bool easy2d::MoveBy::_startTween()
+{
+	if (_target)
+	{
+		return _addTween(TweenManager::Property::Position, _startPos.x, _startPos.y, _deltaPos.x, _deltaPos.y);
+	}
+	return false;
+}
+
 easy2d::MoveBy * easy2d::MoveBy::clone() const
 {
-	return gcnew MoveBy(_duration, _deltaPos);
+	auto action = gcnew MoveBy(_duration, _deltaPos);
+	_copyEase(action, false);
+	return action;
 }
 
 easy2d::MoveBy * easy2d::MoveBy::reverse() const
 {
-	return gcnew MoveBy(_duration, -_deltaPos);
-}
\ No newline at end of file
+	auto action = gcnew MoveBy(_duration, -_deltaPos);
+	_copyEase(action, true);
+	return action;
+}
+
+bool easy2d::MoveBy::_getTweenParams(Node* target, TweenParams& params) const
+{
+	params.prop = TweenManager::Property::Position;
+	params.startX = target->getPosX();
+	params.startY = target->getPosY();
+	params.deltaX = _deltaPos.x;
+	params.deltaY = _deltaPos.y;
+	params.height = 0;
+	params.jumps = 0;
+	return true;
+}
@@ -9,7 +9,9 @@ easy2d::MoveTo::MoveTo(float duration, Point pos)
 
 easy2d::MoveTo * easy2d::MoveTo::clone() const
 {
-	return gcnew MoveTo(_duration, _endPos);
+	auto action = gcnew MoveTo(_duration, _endPos);
+	_copyEase(action, false);
+	return action;
 }
 
 void easy2d::MoveTo::_init()
@@ -17,3 +19,11 @@ void easy2d::MoveTo::_init()
 	MoveBy::_init();
 	_deltaPos = _endPos - _startPos;
 }
+
+bool easy2d::MoveTo::_getTweenParams(Node* target, TweenParams& params) const
+{
+	MoveBy::_getTweenParams(target, params);
+	params.deltaX = _endPos.x - params.startX;
+	params.deltaY = _endPos.y - params.startY;
+	return true;
+}
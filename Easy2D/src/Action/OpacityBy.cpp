@@ -18,9 +18,9 @@ void easy2d::OpacityBy::_init()
 	}
 }
 
-void easy2d::OpacityBy::_update()
+void easy2d::OpacityBy::_update(float dt)
 {
-	FiniteTimeAction::_update();
+	FiniteTimeAction::_update(dt);
 
 	if (_target)
 	{
@@ -28,12 +28,37 @@ void easy2d::OpacityBy::_update()
 	}
 }
 
+bool easy2d::OpacityBy::_startTween()
+{
+	if (_target)
+	{
+		return _addTween(TweenManager::Property::Opacity, _startVal, 0, _deltaVal, 0);
+	}
+	return false;
+}
+
 easy2d::OpacityBy * easy2d::OpacityBy::clone() const
 {
-	return gcnew OpacityBy(_duration, _deltaVal);
+	auto action = gcnew OpacityBy(_duration, _deltaVal);
+	_copyEase(action, false);
+	return action;
 }
 
 easy2d::OpacityBy * easy2d::OpacityBy::reverse() const
 {
-	return gcnew OpacityBy(_duration, -_deltaVal);
-}
\ No newline at end of file
+	auto action = gcnew OpacityBy(_duration, -_deltaVal);
+	_copyEase(action, true);
+	return action;
+}
+
+bool easy2d::OpacityBy::_getTweenParams(Node* target, TweenParams& params) const
+{
+	params.prop = TweenManager::Property::Opacity;
+	params.startX = target->getOpacity();
+	params.startY = 0;
+	params.deltaX = _deltaVal;
+	params.deltaY = 0;
+	params.height = 0;
+	params.jumps = 0;
+	return true;
+}
@@ -10,7 +10,9 @@ easy2d::OpacityTo::OpacityTo(float duration, float opacity)
 
 easy2d::OpacityTo * easy2d::OpacityTo::clone() const
 {
-	return gcnew OpacityTo(_duration, _endVal);
+	auto action = gcnew OpacityTo(_duration, _endVal);
+	_copyEase(action, false);
+	return action;
 }
 
 void easy2d::OpacityTo::_init()
@@ -18,3 +20,10 @@ void easy2d::OpacityTo::_init()
 	OpacityBy::_init();
 	_deltaVal = _endVal - _startVal;
 }
+
+bool easy2d::OpacityTo::_getTweenParams(Node* target, TweenParams& params) const
+{
+	OpacityBy::_getTweenParams(target, params);
+	params.deltaX = _endVal - params.startX;
+	return true;
+}
@@ -18,9 +18,9 @@ void easy2d::RotateBy::_init()
 	}
 }
 
-void easy2d::RotateBy::_update()
+void easy2d::RotateBy::_update(float dt)
 {
-	FiniteTimeAction::_update();
+	FiniteTimeAction::_update(dt);
 
 	if (_target)
 	{
@@ -28,12 +28,37 @@ void easy2d::RotateBy::_update()
 	}
 }
 
+bool easy2d::RotateBy::_startTween()
+{
+	if (_target)
+	{
+		return _addTween(TweenManager::Property::Rotation, _startVal, 0, _deltaVal, 0);
+	}
+	return false;
+}
+
 easy2d::RotateBy * easy2d::RotateBy::clone() const
 {
-	return gcnew RotateBy(_duration, _deltaVal);
+	auto action = gcnew RotateBy(_duration, _deltaVal);
+	_copyEase(action, false);
+	return action;
 }
 
 easy2d::RotateBy * easy2d::RotateBy::reverse() const
 {
-	return gcnew RotateBy(_duration, -_deltaVal);
-}
\ No newline at end of file
+	auto action = gcnew RotateBy(_duration, -_deltaVal);
+	_copyEase(action, true);
+	return action;
+}
+
+bool easy2d::RotateBy::_getTweenParams(Node* target, TweenParams& params) const
+{
+	params.prop = TweenManager::Property::Rotation;
+	params.startX = target->getRotation();
+	params.startY = 0;
+	params.deltaX = _deltaVal;
+	params.deltaY = 0;
+	params.height = 0;
+	params.jumps = 0;
+	return true;
+}
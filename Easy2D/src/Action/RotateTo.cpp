@@ -10,7 +10,9 @@ easy2d::RotateTo::RotateTo(float duration, float rotation)
 
 easy2d::RotateTo * easy2d::RotateTo::clone() const
 {
-	return gcnew RotateTo(_duration, _endVal);
+	auto action = gcnew RotateTo(_duration, _endVal);
+	_copyEase(action, false);
+	return action;
 }
 
 void easy2d::RotateTo::_init()
@@ -18,3 +20,10 @@ void easy2d::RotateTo::_init()
 	RotateBy::_init();
 	_deltaVal = _endVal - _startVal;
 }
+
+bool easy2d::RotateTo::_getTweenParams(Node* target, TweenParams& params) const
+{
+	RotateBy::_getTweenParams(target, params);
+	params.deltaX = _endVal - params.startX;
+	return true;
+}
@@ -27,9 +27,9 @@ void easy2d::ScaleBy::_init()
 	}
 }
 
-void easy2d::ScaleBy::_update()
+void easy2d::ScaleBy::_update(float dt)
 {
-	FiniteTimeAction::_update();
+	FiniteTimeAction::_update(dt);
 
 	if (_target)
 	{
@@ -37,12 +37,37 @@ void easy2d::ScaleBy::_update()
 	}
 }
 
+bool easy2d::ScaleBy::_startTween()
+{
+	if (_target)
+	{
+		return _addTween(TweenManager::Property::Scale, _startScaleX, _startScaleY, _deltaX, _deltaY);
+	}
+	return false;
+}
+
 easy2d::ScaleBy * easy2d::ScaleBy::clone() const
 {
-	return gcnew ScaleBy(_duration, _deltaX, _deltaY);
+	auto action = gcnew ScaleBy(_duration, _deltaX, _deltaY);
+	_copyEase(action, false);
+	return action;
 }
 
 easy2d::ScaleBy * easy2d::ScaleBy::reverse() const
 {
-	return gcnew ScaleBy(_duration, -_deltaX, -_deltaY);
-}
\ No newline at end of file
+	auto action = gcnew ScaleBy(_duration, -_deltaX, -_deltaY);
+	_copyEase(action, true);
+	return action;
+}
+
+bool easy2d::ScaleBy::_getTweenParams(Node* target, TweenParams& params) const
+{
+	params.prop = TweenManager::Property::Scale;
+	params.startX = target->getScaleX();
+	params.startY = target->getScaleY();
+	params.deltaX = _deltaX;
+	params.deltaY = _deltaY;
+	params.height = 0;
+	params.jumps = 0;
+	return true;
+}
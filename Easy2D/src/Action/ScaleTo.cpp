@@ -17,7 +17,9 @@ easy2d::ScaleTo::ScaleTo(float duration, float scaleX, float scaleY)
 
 easy2d::ScaleTo * easy2d::ScaleTo::clone() const
 {
-	return gcnew ScaleTo(_duration, _endScaleX, _endScaleY);
+	auto action = gcnew ScaleTo(_duration, _endScaleX, _endScaleY);
+	_copyEase(action, false);
+	return action;
 }
 
 void easy2d::ScaleTo::_init()
@@ -26,3 +28,11 @@ void easy2d::ScaleTo::_init()
 	_deltaX = _endScaleX - _startScaleX;
 	_deltaY = _endScaleY - _startScaleY;
 }
+
+bool easy2d::ScaleTo::_getTweenParams(Node* target, TweenParams& params) const
+{
+	ScaleBy::_getTweenParams(target, params);
+	params.deltaX = _endScaleX - params.startX;
+	params.deltaY = _endScaleY - params.startY;
+	return true;
+}
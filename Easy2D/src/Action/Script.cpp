@@ -0,0 +1,306 @@
+#include <easy2d/e2daction.h>
+#include <easy2d/e2dnode.h>
+
+easy2d::Script::Script()
+	: _currIndex(0)
+	, _stepStarted(false)
+	, _stepElapsed(0)
+	, _startX(0)
+	, _startY(0)
+	, _deltaX(0)
+	, _deltaY(0)
+{
+}
+
+easy2d::Script::~Script()
+{
+	for (auto& step : _steps)
+	{
+		GC::release(step.node);
+	}
+}
+
+easy2d::Script::Step * easy2d::Script::_addStep(StepType type, Node * node, float duration)
+{
+	if (_initialized)
+	{
+		E2D_WARNING(L"Can not add step to a running Script");
+		return nullptr;
+	}
+
+	if (node)
+	{
+		node->retain();
+	}
+
+	Step step;
+	step.type = type;
+	step.node = node;
+	step.duration = max(duration, 0);
+	step.x = 0;
+	step.y = 0;
+	step.relative = false;
+	step.ease = Ease::Type::Linear;
+	step.func = 0;
+	_steps.push_back(step);
+	return &_steps.back();
+}
+
+easy2d::Script * easy2d::Script::wait(float duration)
+{
+	_addStep(StepType::Wait, nullptr, duration);
+	return this;
+}
+
+easy2d::Script * easy2d::Script::waitUntil(const Function<bool()>& cond)
+{
+	if (cond)
+	{
+		auto step = _addStep(StepType::WaitUntil, nullptr, 0);
+		if (step)
+		{
+			step->func = _conds.size();
+			_conds.push_back(cond);
+		}
+	}
+	return this;
+}
+
+easy2d::Script * easy2d::Script::call(const Function<void()>& func)
+{
+	if (func)
+	{
+		auto step = _addStep(StepType::Call, nullptr, 0);
+		if (step)
+		{
+			step->func = _calls.size();
+			_calls.push_back(func);
+		}
+	}
+	return this;
+}
+
+easy2d::Script * easy2d::Script::moveTo(Node * node, const Point & pos, float duration, Ease::Type ease)
+{
+	auto step = _addStep(StepType::Move, node, duration);
+	if (step)
+	{
+		step->x = pos.x;
+		step->y = pos.y;
+		step->ease = ease;
+	}
+	return this;
+}
+
+easy2d::Script * easy2d::Script::moveBy(Node * node, const Vector2 & vec, float duration, Ease::Type ease)
+{
+	auto step = _addStep(StepType::Move, node, duration);
+	if (step)
+	{
+		step->x = vec.x;
+		step->y = vec.y;
+		step->relative = true;
+		step->ease = ease;
+	}
+	return this;
+}
+
+easy2d::Script * easy2d::Script::scaleTo(Node * node, float scaleX, float scaleY, float duration, Ease::Type ease)
+{
+	auto step = _addStep(StepType::Scale, node, duration);
+	if (step)
+	{
+		step->x = scaleX;
+		step->y = scaleY;
+		step->ease = ease;
+	}
+	return this;
+}
+
+easy2d::Script * easy2d::Script::rotateTo(Node * node, float rotation, float duration, Ease::Type ease)
+{
+	auto step = _addStep(StepType::Rotate, node, duration);
+	if (step)
+	{
+		step->x = rotation;
+		step->ease = ease;
+	}
+	return this;
+}
+
+easy2d::Script * easy2d::Script::opacityTo(Node * node, float opacity, float duration, Ease::Type ease)
+{
+	auto step = _addStep(StepType::Opacity, node, duration);
+	if (step)
+	{
+		step->x = opacity;
+		step->ease = ease;
+	}
+	return this;
+}
+
+void easy2d::Script::reserve(size_t count)
+{
+	_steps.reserve(count);
+}
+
+size_t easy2d::Script::getStepCount() const
+{
+	return _steps.size();
+}
+
+easy2d::Script * easy2d::Script::clone() const
+{
+	auto script = gcnew Script;
+	script->_steps = _steps;
+	script->_calls = _calls;
+	script->_conds = _conds;
+	for (const auto& step : _steps)
+	{
+		if (step.node)
+		{
+			step.node->retain();
+		}
+	}
+	return script;
+}
+
+void easy2d::Script::reset()
+{
+	Action::reset();
+	_currIndex = 0;
+	_stepStarted = false;
+	_stepElapsed = 0;
+}
+
+void easy2d::Script::_init()
+{
+	Action::_init();
+	_currIndex = 0;
+	_stepStarted = false;
+	_stepElapsed = 0;
+}
+
+void easy2d::Script::_update(float dt)
+{
+	// ʼһ֡ʱ䣬һ
+	if (!_initialized)
+	{
+		dt = 0;
+	}
+	Action::_update(dt);
+
+	_stepElapsed += dt;
+
+	// һ֡ڿɶ裬һʣʱһ
+	while (_currIndex < _steps.size())
+	{
+		if (!_runStep())
+			return;
+
+		if (_done)
+			return;
+
+		++_currIndex;
+		_stepStarted = false;
+	}
+
+	this->stop();
+}
+
+bool easy2d::Script::_runStep()
+{
+	const Step& step = _steps[_currIndex];
+
+	switch (step.type)
+	{
+	case StepType::Wait:
+		if (_stepElapsed < step.duration)
+			return false;
+
+		_stepElapsed -= step.duration;
+		return true;
+
+	case StepType::WaitUntil:
+		if (!_conds[step.func]())
+			return false;
+
+		_stepElapsed = 0;
+		return true;
+
+	case StepType::Call:
+		_calls[step.func]();
+		return true;
+
+	default:
+		break;
+	}
+
+	Node * node = step.node ? step.node : _target;
+	if (node == nullptr)
+	{
+		_stepElapsed = max(_stepElapsed - step.duration, 0);
+		return true;
+	}
+
+	// 벽ʱ¼ʼֵ
+	if (!_stepStarted)
+	{
+		_stepStarted = true;
+
+		switch (step.type)
+		{
+		case StepType::Move:
+			_startX = node->getPosX();
+			_startY = node->getPosY();
+			break;
+		case StepType::Scale:
+			_startX = node->getScaleX();
+			_startY = node->getScaleY();
+			break;
+		case StepType::Rotate:
+			_startX = node->getRotation();
+			_startY = 0;
+			break;
+		case StepType::Opacity:
+			_startX = node->getOpacity();
+			_startY = 0;
+			break;
+		default:
+			break;
+		}
+
+		_deltaX = step.relative ? step.x : step.x - _startX;
+		_deltaY = step.relative ? step.y : step.y - _startY;
+	}
+
+	float progress = step.duration > 0 ? min(_stepElapsed / step.duration, 1.f) : 1.f;
+	float value = progress >= 1 ? 1.f : Ease::apply(step.ease, progress);
+
+	float x = _startX + _deltaX * value;
+	float y = _startY + _deltaY * value;
+
+	switch (step.type)
+	{
+	case StepType::Move:
+		node->setPos(x, y);
+		break;
+	case StepType::Scale:
+		node->setScale(x, y);
+		break;
+	case StepType::Rotate:
+		node->setRotation(x);
+		break;
+	case StepType::Opacity:
+		node->setOpacity(x);
+		break;
+	default:
+		break;
+	}
+
+	if (progress < 1)
+		return false;
+
+	_stepElapsed -= step.duration;
+	return true;
+}
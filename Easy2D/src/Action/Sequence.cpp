@@ -34,14 +34,14 @@ void easy2d::Sequence::_init()
 	_actions[0]->_init();
 }
 
-void easy2d::Sequence::_update()
+void easy2d::Sequence::_update(float dt)
 {
-	Action::_update();
+	Action::_update(dt);
 
 	if (!_actions.empty())
 	{
 		auto& action = _actions[_currIndex];
-		action->_update();
+		action->_update(dt);
 
 		if (action->_isDone())
 		{
@@ -0,0 +1,131 @@
+#include <easy2d/e2daction.h>
+#include <easy2d/e2dnode.h>
+
+easy2d::SheetAnimate::SheetAnimate()
+	: _frameIndex(0)
+	, _sprite(nullptr)
+	, _sheet(nullptr)
+	, _image(nullptr)
+{
+}
+
+easy2d::SheetAnimate::SheetAnimate(SpriteSheet * sheet)
+	: _frameIndex(0)
+	, _sprite(nullptr)
+	, _sheet(nullptr)
+	, _image(nullptr)
+{
+	this->setSpriteSheet(sheet);
+}
+
+easy2d::SheetAnimate::~SheetAnimate()
+{
+	GC::release(_sheet);
+	GC::release(_image);
+}
+
+easy2d::SpriteSheet * easy2d::SheetAnimate::getSpriteSheet() const
+{
+	return _sheet;
+}
+
+void easy2d::SheetAnimate::setSpriteSheet(SpriteSheet * sheet)
+{
+	if (sheet && sheet != _sheet)
+	{
+		GC::release(_sheet);
+		_sheet = sheet;
+		_sheet->retain();
+	}
+}
+
+void easy2d::SheetAnimate::_init()
+{
+	Action::_init();
+
+	_frameIndex = 0;
+	// ֻڿʼʱתһĿ
+	_sprite = dynamic_cast<Sprite*>(_target);
+
+	if (!_sprite || !_sheet || !_sheet->getImage() || _sheet->getFrames().empty())
+	{
+		_sprite = nullptr;
+		return;
+	}
+
+	// üα Image УҪһռġͼλͼ Image
+	// Ӱʹͬһ Image 顣
+	// ԭе Image ܱ鹲ֻظʹñ Image
+	ID2D1Bitmap * bitmap = _sheet->getImage()->getBitmap();
+	if (!_image || _image != _sprite->getImage() || _image->getBitmap() != bitmap)
+	{
+		GC::release(_image);
+		_image = gcnew Image(bitmap, _sheet->getFrames()[0]);
+		_image->retain();
+		_sprite->open(_image);
+	}
+	_sprite->crop(_sheet->getFrames()[0]);
+}
+
+void easy2d::SheetAnimate::_update(float dt)
+{
+	Action::_update(dt);
+
+	if (!_sprite)
+	{
+		this->stop();
+		return;
+	}
+
+	// ֱɾʱ֡
+	const size_t count = _sheet->getFrames().size();
+	const float interval = _sheet->getInterval();
+	size_t index = interval > 0 ? static_cast<size_t>(_elapsed / interval) : count;
+
+	if (index >= count)
+	{
+		_showFrame(count - 1);
+		this->stop();
+	}
+	else
+	{
+		_showFrame(index);
+	}
+}
+
+void easy2d::SheetAnimate::_showFrame(size_t index)
+{
+	if (index != _frameIndex)
+	{
+		_frameIndex = index;
+		_sprite->crop(_sheet->getFrames()[index]);
+	}
+}
+
+void easy2d::SheetAnimate::reset()
+{
+	Action::reset();
+	_frameIndex = 0;
+}
+
+easy2d::SheetAnimate * easy2d::SheetAnimate::clone() const
+{
+	if (_sheet)
+	{
+		return gcnew SheetAnimate(_sheet);
+	}
+	return nullptr;
+}
+
+easy2d::SheetAnimate * easy2d::SheetAnimate::reverse() const
+{
+	if (_sheet)
+	{
+		auto sheet = _sheet->reverse();
+		if (sheet)
+		{
+			return gcnew SheetAnimate(sheet);
+		}
+	}
+	return nullptr;
+}
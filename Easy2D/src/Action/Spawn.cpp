@@ -31,9 +31,9 @@ void easy2d::Spawn::_init()
 	}
 }
 
-void easy2d::Spawn::_update()
+void easy2d::Spawn::_update(float dt)
 {
-	Action::_update();
+	Action::_update(dt);
 
 	if (!_actions.empty())
 	{
@@ -46,7 +46,7 @@ void easy2d::Spawn::_update()
 			}
 			else
 			{
-				action->_update();
+				action->_update(dt);
 			}
 		}
 
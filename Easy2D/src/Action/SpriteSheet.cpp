@@ -0,0 +1,104 @@
+#include <easy2d/e2daction.h>
+
+easy2d::SpriteSheet::SpriteSheet()
+	: _interval(1)
+	, _image(nullptr)
+{
+}
+
+easy2d::SpriteSheet::SpriteSheet(Image * image, float interval)
+	: _interval(max(interval, 0))
+	, _image(nullptr)
+{
+	this->setImage(image);
+}
+
+easy2d::SpriteSheet::SpriteSheet(Image * image, int cols, int rows, float interval)
+	: _interval(max(interval, 0))
+	, _image(nullptr)
+{
+	this->setImage(image);
+	this->split(cols, rows);
+}
+
+easy2d::SpriteSheet::~SpriteSheet()
+{
+	GC::release(_image);
+}
+
+void easy2d::SpriteSheet::setImage(Image * image)
+{
+	if (image && image != _image)
+	{
+		GC::release(_image);
+		_image = image;
+		_image->retain();
+	}
+}
+
+void easy2d::SpriteSheet::add(const Rect& frame)
+{
+	_frames.push_back(frame);
+}
+
+void easy2d::SpriteSheet::add(const std::vector<Rect>& frames)
+{
+	_frames.insert(_frames.end(), frames.begin(), frames.end());
+}
+
+void easy2d::SpriteSheet::split(int cols, int rows)
+{
+	if (!_image || cols <= 0 || rows <= 0)
+	{
+		E2D_WARNING(L"SpriteSheet::split failed! Invalid image or size.");
+		return;
+	}
+
+	// ͼƬǰĲüΪΧз֣ʹͼеͼƬҲΪ
+	float width = _image->getWidth() / cols;
+	float height = _image->getHeight() / rows;
+	Point origin = _image->getCropPos();
+
+	_frames.reserve(_frames.size() + cols * rows);
+	for (int row = 0; row < rows; ++row)
+	{
+		for (int col = 0; col < cols; ++col)
+		{
+			_frames.push_back(Rect(origin.x + col * width, origin.y + row * height, width, height));
+		}
+	}
+}
+
+easy2d::Image * easy2d::SpriteSheet::getImage() const
+{
+	return _image;
+}
+
+const std::vector<easy2d::Rect>& easy2d::SpriteSheet::getFrames() const
+{
+	return _frames;
+}
+
+float easy2d::SpriteSheet::getInterval() const
+{
+	return _interval;
+}
+
+void easy2d::SpriteSheet::setInterval(float interval)
+{
+	_interval = max(interval, 0);
+}
+
+easy2d::SpriteSheet * easy2d::SpriteSheet::clone() const
+{
+	auto sheet = gcnew SpriteSheet(_image, _interval);
+	sheet->add(_frames);
+	return sheet;
+}
+
+easy2d::SpriteSheet * easy2d::SpriteSheet::reverse() const
+{
+	auto sheet = gcnew SpriteSheet(_image, _interval);
+	sheet->add(std::vector<Rect>(_frames.rbegin(), _frames.rend()));
+	return sheet;
+}
@@ -0,0 +1,269 @@
+#include <easy2d/e2daction.h>
+#include <easy2d/e2dnode.h>
+
+easy2d::TweenGroup::TweenGroup(FiniteTimeAction * action, const std::vector<Node*>& targets, float stagger)
+	: _action(action)
+	, _prop(TweenManager::Property::Position)
+	, _height(0)
+	, _jumps(0)
+	, _totalDuration(0)
+	, _uniform(true)
+{
+	if (_action)
+	{
+		_action->retain();
+	}
+	else
+	{
+		E2D_WARNING(L"TweenGroup NULL pointer exception!");
+	}
+	this->add(targets, stagger);
+}
+
+easy2d::TweenGroup::~TweenGroup()
+{
+	GC::release(_action);
+	for (auto target : _targets)
+	{
+		GC::release(target);
+	}
+}
+
+void easy2d::TweenGroup::add(Node * target, float offset)
+{
+	if (target == nullptr)
+		return;
+
+	if (_initialized)
+	{
+		E2D_WARNING(L"Can not add target to a running TweenGroup");
+		return;
+	}
+
+	offset = max(offset, 0);
+	if (!_offsets.empty() && _offsets.front() != offset)
+	{
+		_uniform = false;
+	}
+
+	target->retain();
+	_targets.push_back(target);
+	_offsets.push_back(offset);
+}
+
+void easy2d::TweenGroup::add(const std::vector<Node*>& targets, float stagger)
+{
+	float offset = _offsets.empty() ? 0 : _offsets.back() + stagger;
+	for (auto target : targets)
+	{
+		this->add(target, offset);
+		offset += stagger;
+	}
+}
+
+size_t easy2d::TweenGroup::getTargetCount() const
+{
+	return _targets.size();
+}
+
+easy2d::TweenGroup * easy2d::TweenGroup::clone() const
+{
+	auto group = gcnew TweenGroup(_action ? _action->clone() : nullptr);
+	for (size_t i = 0; i < _targets.size(); ++i)
+	{
+		group->add(_targets[i], _offsets[i]);
+	}
+	return group;
+}
+
+easy2d::TweenGroup * easy2d::TweenGroup::reverse() const
+{
+	auto group = gcnew TweenGroup(_action ? _action->reverse() : nullptr);
+	for (size_t i = 0; i < _targets.size(); ++i)
+	{
+		group->add(_targets[i], _offsets[i]);
+	}
+	return group;
+}
+
+void easy2d::TweenGroup::reset()
+{
+	Action::reset();
+	_active.clear();
+}
+
+void easy2d::TweenGroup::_init()
+{
+	Action::_init();
+
+	const size_t size = _targets.size();
+	_startX.resize(size);
+	_startY.resize(size);
+	_deltaX.resize(size);
+	_deltaY.resize(size);
+	_prevX.resize(size);
+	_prevY.resize(size);
+	_values.assign(size, 0.f);
+	// ΪʾĿδ
+	_progress.assign(size, -1.f);
+	_active.clear();
+	_active.reserve(size);
+	_totalDuration = 0;
+
+	if (_action == nullptr || size == 0)
+	{
+		this->stop();
+		return;
+	}
+
+	// Ŀ޹أʼֵڸĿʱż¼
+	// ʹӳĿӵʱ״̬ʼ֮Ľȫɱͳһ
+	FiniteTimeAction::TweenParams params;
+	if (!_action->_getTweenParams(_targets.front(), params))
+	{
+		E2D_WARNING(L"TweenGroup only supports move, jump, scale, opacity and rotate actions");
+		this->stop();
+		return;
+	}
+	_prop = params.prop;
+	_height = params.height;
+	_jumps = params.jumps;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		_totalDuration = max(_totalDuration, _offsets[i] + _action->_duration);
+	}
+}
+
+void easy2d::TweenGroup::_startTarget(size_t index)
+{
+	FiniteTimeAction::TweenParams params;
+	_action->_getTweenParams(_targets[index], params);
+
+	_startX[index] = _prevX[index] = params.startX;
+	_startY[index] = _prevY[index] = params.startY;
+	_deltaX[index] = params.deltaX;
+	_deltaY[index] = params.deltaY;
+}
+
+void easy2d::TweenGroup::_update(float dt)
+{
+	Action::_update(dt);
+
+	if (_done)
+		return;
+
+	const float duration = _action->_duration;
+	const size_t size = _targets.size();
+
+	auto progressAt = [=](float offset) -> float
+	{
+		float t = _elapsed - offset;
+		if (t < 0)
+			return -1.f;
+		return duration > 0 ? min(t / duration, 1.f) : 1.f;
+	};
+
+	auto easeAt = [this](float progress) -> float
+	{
+		if (progress >= 1)
+			return 1.f;
+		return _action->_easeFunc ? _action->_easeFunc(progress) : Ease::apply(_action->_easeType, progress);
+	};
+
+	// ռ֡ҪµĿ꣺һ֡δ
+	_active.clear();
+	if (_uniform)
+	{
+		float progress = progressAt(_offsets.front());
+		if (progress >= 0 && _progress.front() < 1)
+		{
+			// ʱͬĿ깲һλ
+			float value = easeAt(progress);
+			for (size_t i = 0; i < size; ++i)
+			{
+				if (_progress[i] < 0)
+				{
+					_startTarget(i);
+				}
+				_progress[i] = progress;
+				_values[i] = value;
+				_active.push_back(i);
+			}
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (_progress[i] >= 1)
+				continue;
+
+			float progress = progressAt(_offsets[i]);
+			if (progress < 0)
+				continue;
+
+			if (_progress[i] < 0)
+			{
+				_startTarget(i);
+			}
+			_progress[i] = progress;
+			_values[i] = easeAt(progress);
+			_active.push_back(i);
+		}
+	}
+
+	switch (_prop)
+	{
+	case TweenManager::Property::Position:
+	case TweenManager::Property::Jump:
+	{
+		const bool jump = (_prop == TweenManager::Property::Jump);
+		for (auto i : _active)
+		{
+			Node * target = _targets[i];
+			float value = _values[i];
+
+			// ڵڶⷢλ
+			_startX[i] += target->getPosX() - _prevX[i];
+			_startY[i] += target->getPosY() - _prevY[i];
+
+			float x = _startX[i] + _deltaX[i] * value;
+			float y = _startY[i] + _deltaY[i] * value;
+			if (jump)
+			{
+				float frac = std::fmodf(value * _jumps, 1.0f);
+				y += _height * 4 * frac * (1 - frac);
+			}
+
+			target->setPos(x, y);
+			_prevX[i] = x;
+			_prevY[i] = y;
+		}
+		break;
+	}
+	case TweenManager::Property::Scale:
+		for (auto i : _active)
+		{
+			_targets[i]->setScale(_startX[i] + _deltaX[i] * _values[i], _startY[i] + _deltaY[i] * _values[i]);
+		}
+		break;
+	case TweenManager::Property::Rotation:
+		for (auto i : _active)
+		{
+			_targets[i]->setRotation(_startX[i] + _deltaX[i] * _values[i]);
+		}
+		break;
+	case TweenManager::Property::Opacity:
+		for (auto i : _active)
+		{
+			_targets[i]->setOpacity(_startX[i] + _deltaX[i] * _values[i]);
+		}
+		break;
+	}
+
+	if (_elapsed >= _totalDuration)
+	{
+		this->stop();
+	}
+}
@@ -11,6 +11,10 @@ static bool s_bPaused = false;
 static bool s_bInitialized = false;
 // Ϸ
 static easy2d::String s_sGameName;
+// ʱű
+static float s_fTimeScale = 1.f;
+// ̶֡
+static float s_fFixedDeltaTime = 0.f;
 
 
 bool easy2d::Game::init(const String& title, int width, int height, const String& mutexName)
@@ -129,13 +133,29 @@ void easy2d::Game::start()
 		// жǷﵽˢ״̬
 		if (Time::__isReady())
 		{
+			Profiler::__beginPhase(FrameHistory::Update);
 			Input::__update();			// ȡû
-			Timer::__update();			// ¶ʱ
-			ActionManager::__update();	// ¶
-			SceneManager::__update();	// ³
+
+			// ¼ƻط룬طʱʹ¼ʱ֡
+			float dt = s_fFixedDeltaTime > 0 ? s_fFixedDeltaTime : Time::getDeltaTime();
+			InputRecorder::__update(dt);
+
+			EventQueue::__dispatch();	// ַ¼
+			AudioMixer::__update();		// ղϵ
+			Profiler::__endPhase(FrameHistory::Update);
+
+			// ƽϷ߼
+			Game::step(dt);
+
+			Profiler::__beginPhase(FrameHistory::Render);
 			Renderer::__render();		// ȾϷ
+			Profiler::__endPhase(FrameHistory::Render);
+
+			Profiler::__beginPhase(FrameHistory::GC);
 			GC::clear();				// ڴ
+			Profiler::__endPhase(FrameHistory::GC);
 
+			Profiler::__endFrame();		// ¼һ֡ĺʱ
 			Time::__updateLast();		// ˢʱϢ
 		}
 		else
@@ -146,10 +166,16 @@ void easy2d::Game::start()
 
 	// ʱԴ
 	{
+		// ¼ƺͻط
+		InputRecorder::__uninit();
+		// ¼
+		EventQueue::__uninit();
 		// ɾ
 		ActionManager::__uninit();
 		// ֲԴ
 		MusicPlayer::__uninit();
+		// Ч
+		SoundPool::__uninit();
 		// նʱ
 		Timer::__uninit();
 		// ɾг
@@ -188,6 +214,44 @@ bool easy2d::Game::isPaused()
 	return s_bPaused;
 }
 
+void easy2d::Game::setTimeScale(float scale)
+{
+	s_fTimeScale = max(scale, 0);
+}
+
+float easy2d::Game::getTimeScale()
+{
+	return s_fTimeScale;
+}
+
+void easy2d::Game::setFixedDeltaTime(float dt)
+{
+	s_fFixedDeltaTime = max(dt, 0);
+}
+
+float easy2d::Game::getFixedDeltaTime()
+{
+	return s_fFixedDeltaTime;
+}
+
+void easy2d::Game::step(float dt)
+{
+	dt *= s_fTimeScale;
+
+	Profiler::__beginPhase(FrameHistory::Update);
+	Timer::__update(dt);			// ¶ʱ
+	Profiler::__endPhase(FrameHistory::Update);
+
+	Profiler::__beginPhase(FrameHistory::Actions);
+	ActionManager::__update(dt);	// ¶
+	TweenManager::__update(dt);		// ²䶯
+	Profiler::__endPhase(FrameHistory::Actions);
+
+	Profiler::__beginPhase(FrameHistory::Update);
+	SceneManager::__update();		// ³
+	Profiler::__endPhase(FrameHistory::Update);
+}
+
 void easy2d::Game::quit()
 {
 	s_bEndGame = true;	// ϷǷ
@@ -198,10 +262,14 @@ void easy2d::Game::destroy()
 	if (!s_bInitialized)
 		return;
 
+	// дϷ
+	Data::__uninit();
 	// ͼƬ
 	Image::clearCache();
 	// Դ
 	Music::__uninit();
+	// жԴ
+	Package::__uninit();
 	// ر
 	Input::__uninit();
 	// ȾԴ
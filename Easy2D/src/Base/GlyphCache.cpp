@@ -0,0 +1,192 @@
+#include <easy2d/e2dbase.h>
+
+bool easy2d::GlyphKey::operator==(const GlyphKey & other) const
+{
+	return fontFace == other.fontFace &&
+		fontSize == other.fontSize &&
+		glyph == other.glyph &&
+		outline == other.outline &&
+		lineJoin == other.lineJoin;
+}
+
+size_t easy2d::GlyphCache::KeyHasher::operator()(const GlyphKey & key) const
+{
+	size_t hash = std::hash<const void*>{}(key.fontFace);
+	hash ^= std::hash<float>{}(key.fontSize) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	hash ^= std::hash<UINT>{}(UINT(key.glyph) | (UINT(key.lineJoin) << 16)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	hash ^= std::hash<float>{}(key.outline) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	return hash;
+}
+
+float easy2d::GlyphCache::Stats::getHitRate() const
+{
+	UINT64 total = hits + misses;
+	return total ? float(double(hits) / total) : 0.f;
+}
+
+easy2d::GlyphCache::GlyphCache(GlyphRasterizer * rasterizer, int pageWidth, int pageHeight, int maxPages, int padding)
+	: _rasterizer(rasterizer)
+	, _pageWidth(max(pageWidth, 1))
+	, _pageHeight(max(pageHeight, 1))
+	, _maxPages(max(maxPages, 1))
+	, _padding(max(padding, 0))
+	, _usedArea(0)
+	, _hits(0)
+	, _misses(0)
+	, _resets(0)
+{
+}
+
+easy2d::GlyphCache::~GlyphCache()
+{
+	clear();
+}
+
+const easy2d::GlyphCache::Entry * easy2d::GlyphCache::get(const GlyphKey & key)
+{
+	auto iter = _entries.find(key);
+	if (iter != _entries.end())
+	{
+		++_hits;
+		return &iter->second;
+	}
+
+	++_misses;
+
+	if (!_rasterizer)
+		return nullptr;
+
+	Entry entry = { 0 };
+	if (!_rasterizer->measure(key, entry.width, entry.height, entry.originX, entry.originY))
+		return nullptr;
+
+	// հβռͼ
+	if (entry.width <= 0 || entry.height <= 0)
+	{
+		entry.width = entry.height = 0;
+		return &_entries.insert(std::make_pair(key, entry)).first->second;
+	}
+
+	// ͼҳ޷
+	if (entry.width + _padding > _pageWidth || entry.height + _padding > _pageHeight)
+		return nullptr;
+
+	if (!_allocate(entry.width, entry.height, entry.page, entry.x, entry.y))
+	{
+		// ͼպ¿ʼ
+		clear();
+		++_resets;
+
+		if (!_allocate(entry.width, entry.height, entry.page, entry.x, entry.y))
+			return nullptr;
+	}
+
+	if (!_rasterizer->draw(key, entry.page, entry.x + entry.originX, entry.y + entry.originY))
+		return nullptr;
+
+	_usedArea += INT64(entry.width) * entry.height;
+	return &_entries.insert(std::make_pair(key, entry)).first->second;
+}
+
+void easy2d::GlyphCache::clear()
+{
+	_entries.clear();
+	_pages.clear();
+	_usedArea = 0;
+
+	if (_rasterizer)
+	{
+		_rasterizer->clearPages();
+	}
+}
+
+easy2d::GlyphCache::Stats easy2d::GlyphCache::getStats() const
+{
+	Stats stats;
+	stats.pageCount = int(_pages.size());
+	stats.glyphCount = int(_entries.size());
+	stats.occupancy = _pages.empty() ? 0.f : float(double(_usedArea) / (double(_pageWidth) * _pageHeight * _pages.size()));
+	stats.hits = _hits;
+	stats.misses = _misses;
+	stats.resets = _resets;
+	return stats;
+}
+
+void easy2d::GlyphCache::resetStats()
+{
+	_hits = 0;
+	_misses = 0;
+	_resets = 0;
+}
+
+bool easy2d::GlyphCache::_allocate(int width, int height, int & page, int & x, int & y)
+{
+	// ͬһֺŵθ߶ŲȷŽ߶ӽ
+	int paddedWidth = width + _padding;
+	int paddedHeight = height + _padding;
+
+	Shelf * best = nullptr;
+	int bestPage = -1;
+	for (size_t i = 0; i < _pages.size(); ++i)
+	{
+		for (auto& shelf : _pages[i].shelves)
+		{
+			if (shelf.height < paddedHeight || shelf.x + paddedWidth > _pageWidth)
+				continue;
+
+			// и߱θ̫ʱ룬˷ѿռ
+			if (shelf.height > paddedHeight * 3 / 2 + 2)
+				continue;
+
+			if (!best || shelf.height < best->height)
+			{
+				best = &shelf;
+				bestPage = int(i);
+			}
+		}
+	}
+
+	if (!best)
+	{
+		// еҳ¿һ
+		for (size_t i = 0; i < _pages.size(); ++i)
+		{
+			Page& p = _pages[i];
+			if (p.nextShelfY + paddedHeight <= _pageHeight)
+			{
+				Shelf shelf = { p.nextShelfY, paddedHeight, 0 };
+				p.shelves.push_back(shelf);
+				p.nextShelfY += paddedHeight;
+				best = &p.shelves.back();
+				bestPage = int(i);
+				break;
+			}
+		}
+	}
+
+	if (!best)
+	{
+		// ½ͼҳ
+		if (int(_pages.size()) >= _maxPages)
+			return false;
+
+		int id = int(_pages.size());
+		if (!_rasterizer->createPage(id, _pageWidth, _pageHeight))
+			return false;
+
+		Page p;
+		p.nextShelfY = paddedHeight;
+		Shelf shelf = { 0, paddedHeight, 0 };
+		p.shelves.push_back(shelf);
+		_pages.push_back(p);
+
+		best = &_pages.back().shelves.back();
+		bestPage = id;
+	}
+
+	page = bestPage;
+	x = best->x;
+	y = best->y;
+	best->x += paddedWidth;
+	return true;
+}
@@ -1,4 +1,3 @@
-#include <unordered_map>
 #include <easy2d/e2dbase.h>
 #include <easy2d/e2dmanager.h>
 
@@ -14,15 +13,22 @@ namespace
 	IDirectInput8* s_pDirectInput = nullptr;			// DirectInput ӿڶ
 	IDirectInputDevice8* s_KeyboardDevice = nullptr;	// 豸ӿ
 	char s_KeyBuffer[BUFFER_SIZE] = { 0 };				// ڱ̰Ϣ
-	char s_KeyRecordBuffer[BUFFER_SIZE] = { 0 };		// Ϣ
+	KeyState s_KeyState;								// ̰״̬
 
 	IDirectInputDevice8* s_MouseDevice = nullptr;		// 豸ӿ
 	DIMOUSESTATE s_MouseState;							// Ϣ洢ṹ
 	DIMOUSESTATE s_MouseRecordState;					// Ϣ
 	POINT s_MousePosition;								// λô洢ṹ
 
-	const std::unordered_map<int, int> s_KeyboardMapping = {
-		{ KeyCode::Unknown, 0x00 },
+	// ֵ DirectInput ɨĶӦϵ
+	struct KeyMapping
+	{
+		KeyCode::Value key;
+		BYTE dik;
+	};
+
+	// ÿ֡ݴ˰Ѽ̻תΪ
+	const KeyMapping s_KeyboardMapping[] = {
 		{ KeyCode::Up, DIK_UP },
 		{ KeyCode::Left, DIK_LEFT },
 		{ KeyCode::Right, DIK_RIGHT },
@@ -104,7 +110,7 @@ namespace
 bool Input::__init()
 {
 	ZeroMemory(s_KeyBuffer, sizeof(s_KeyBuffer));
-	ZeroMemory(s_KeyRecordBuffer, sizeof(s_KeyRecordBuffer));
+	s_KeyState.reset();
 	ZeroMemory(&s_MouseState, sizeof(s_MouseState));
 	ZeroMemory(&s_MouseRecordState, sizeof(s_MouseRecordState));
 
@@ -180,6 +186,10 @@ void Input::__uninit()
 
 void easy2d::Input::__update()
 {
+	// طʱ״̬ InputRecorder ṩ
+	if (InputRecorder::isReplaying())
+		return;
+
 	if (s_KeyboardDevice)
 	{
 		HRESULT hr = s_KeyboardDevice->Poll();
@@ -191,11 +201,19 @@ void easy2d::Input::__update()
 		}
 		else
 		{
-			for (int i = 0; i < BUFFER_SIZE; ++i)
-				s_KeyRecordBuffer[i] = s_KeyBuffer[i];
-
 			s_KeyboardDevice->GetDeviceState(sizeof(s_KeyBuffer), (void**)& s_KeyBuffer);
 		}
+
+		// 豸ʧʱֲ䣬֡ºɿİ֮
+		KeySet current;
+		for (const auto& mapping : s_KeyboardMapping)
+		{
+			if (s_KeyBuffer[mapping.dik] & 0x80)
+			{
+				current.add(mapping.key);
+			}
+		}
+		s_KeyState.update(current);
 	}
 
 	if (s_MouseDevice)
@@ -218,30 +236,78 @@ void easy2d::Input::__update()
 	ScreenToClient(Window::getHWnd(), &s_MousePosition);
 }
 
+void easy2d::Input::__getFrame(InputFrame& frame)
+{
+	frame.keys = s_KeyState.getDown();
+	frame.mouseButtons = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		if (s_MouseState.rgbButtons[i] & 0x80)
+		{
+			frame.mouseButtons |= BYTE(1 << i);
+		}
+	}
+	frame.mouseX = (float)s_MousePosition.x;
+	frame.mouseY = (float)s_MousePosition.y;
+	frame.mouseDeltaX = (float)s_MouseState.lX;
+	frame.mouseDeltaY = (float)s_MouseState.lY;
+	frame.mouseDeltaZ = (float)s_MouseState.lZ;
+}
+
+void easy2d::Input::__setFrame(const InputFrame& frame)
+{
+	s_KeyState.update(frame.keys);
+
+	s_MouseRecordState = s_MouseState;
+	for (int i = 0; i < 4; ++i)
+	{
+		s_MouseState.rgbButtons[i] = (frame.mouseButtons & (1 << i)) ? 0x80 : 0;
+	}
+	s_MouseState.lX = (LONG)frame.mouseDeltaX;
+	s_MouseState.lY = (LONG)frame.mouseDeltaY;
+	s_MouseState.lZ = (LONG)frame.mouseDeltaZ;
+	s_MousePosition.x = (LONG)frame.mouseX;
+	s_MousePosition.y = (LONG)frame.mouseY;
+}
+
 bool Input::isDown(KeyCode::Value key)
 {
-	int dik = s_KeyboardMapping.at(key);
-	if (s_KeyBuffer[dik] & 0x80)
-		return true;
-	return false;
+	return s_KeyState.isDown(key);
 }
 
 bool Input::isPress(KeyCode::Value key)
 {
-	int dik = s_KeyboardMapping.at(key);
-	if ((s_KeyBuffer[dik] & 0x80) &&
-		!(s_KeyRecordBuffer[dik] & 0x80))
-		return true;
-	return false;
+	return s_KeyState.isPress(key);
 }
 
 bool Input::isRelease(KeyCode::Value key)
 {
-	int dik = s_KeyboardMapping.at(key);
-	if (!(s_KeyBuffer[dik] & 0x80) &&
-		(s_KeyRecordBuffer[dik] & 0x80))
-		return true;
-	return false;
+	return s_KeyState.isRelease(key);
+}
+
+bool Input::isAnyDown(const KeySet& keys)
+{
+	return s_KeyState.getDown().containsAny(keys);
+}
+
+bool Input::isAllDown(const KeySet& keys)
+{
+	return s_KeyState.getDown().containsAll(keys);
+}
+
+bool Input::isAnyPress(const KeySet& keys)
+{
+	return s_KeyState.getPressed().containsAny(keys);
+}
+
+bool Input::isAnyRelease(const KeySet& keys)
+{
+	return s_KeyState.getReleased().containsAny(keys);
+}
+
+const KeyState& Input::getKeyState()
+{
+	return s_KeyState;
 }
 
 bool easy2d::Input::isDown(MouseCode::Value code)
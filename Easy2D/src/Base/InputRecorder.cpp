@@ -0,0 +1,441 @@
+#include <easy2d/e2dbase.h>
+#include <easy2d/e2dmanager.h>
+#include <fstream>
+#include <chrono>
+
+using namespace std::chrono;
+
+namespace
+{
+	// ļͷ
+	const char REPLAY_MAGIC[4] = { 'E', '2', 'D', 'R' };
+	const UINT32 REPLAY_VERSION = 1;
+	// ļͷ֡ڵλ
+	const std::streamoff REPLAY_FRAME_COUNT_OFFSET = 8;
+
+	// ÿֻ֡дһ֡ͬĲ֣ɱ־λ˵
+	enum FrameFlag : BYTE
+	{
+		FRAME_DELTA_TIME	= 0x01,		// ֡
+		FRAME_KEYS			= 0x02,		// 
+		FRAME_MOUSE_BUTTONS	= 0x04,		// 갴
+		FRAME_MOUSE_POS		= 0x08,		// 
+		FRAME_MOUSE_DELTA	= 0x10,		// 
+		FRAME_EVENTS		= 0x20,		// ¼
+	};
+
+	struct EventRecord
+	{
+		UINT type;
+		float x;
+		float y;
+		float delta;
+		int code;
+		int count;
+	};
+
+	bool s_bRecording = false;
+	bool s_bReplaying = false;
+	std::ofstream s_Output;
+	std::ifstream s_Input;
+	UINT32 s_nFrameIndex = 0;
+	easy2d::InputFrame s_LastFrame;
+	std::vector<EventRecord> s_vEvents;
+	easy2d::Function<void()> s_ReplayEndCallback;
+	easy2d::InputRecorder::Stats s_Stats = { 0, 0, 0 };
+	steady_clock::time_point s_tLastFrame;
+
+	template <typename T>
+	void Write(const T& value)
+	{
+		s_Output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template <typename T>
+	bool Read(T& value)
+	{
+		s_Input.read(reinterpret_cast<char*>(&value), sizeof(T));
+		return s_Input.gcount() == sizeof(T);
+	}
+
+	void WriteEvent(const EventRecord& record)
+	{
+		Write(BYTE(record.type));
+		switch (record.type)
+		{
+		case easy2d::Event::MouseMove:
+			Write(record.x);
+			Write(record.y);
+			break;
+		case easy2d::Event::MouseDown:
+		case easy2d::Event::MouseUp:
+			Write(record.x);
+			Write(record.y);
+			Write(BYTE(record.code));
+			break;
+		case easy2d::Event::MouseWheel:
+			Write(record.x);
+			Write(record.y);
+			Write(record.delta);
+			break;
+		case easy2d::Event::KeyDown:
+		case easy2d::Event::KeyUp:
+			Write(BYTE(record.code));
+			Write(BYTE(record.count));
+			break;
+		}
+	}
+
+	bool ReadEvent(EventRecord& record)
+	{
+		BYTE type = 0, code = 0, count = 0;
+		if (!Read(type))
+			return false;
+
+		record.type = type;
+		record.x = record.y = record.delta = 0;
+		record.code = record.count = 0;
+
+		switch (type)
+		{
+		case easy2d::Event::MouseMove:
+			return Read(record.x) && Read(record.y);
+		case easy2d::Event::MouseDown:
+		case easy2d::Event::MouseUp:
+			if (!Read(record.x) || !Read(record.y) || !Read(code))
+				return false;
+			record.code = code;
+			return true;
+		case easy2d::Event::MouseWheel:
+			return Read(record.x) && Read(record.y) && Read(record.delta);
+		case easy2d::Event::KeyDown:
+		case easy2d::Event::KeyUp:
+			if (!Read(code) || !Read(count))
+				return false;
+			record.code = code;
+			record.count = count;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	BYTE GetFrameFlags(const easy2d::InputFrame& frame)
+	{
+		const easy2d::InputFrame& last = s_LastFrame;
+
+		BYTE flags = 0;
+		if (frame.deltaTime != last.deltaTime)
+			flags |= FRAME_DELTA_TIME;
+		if (frame.keys != last.keys)
+			flags |= FRAME_KEYS;
+		if (frame.mouseButtons != last.mouseButtons)
+			flags |= FRAME_MOUSE_BUTTONS;
+		if (frame.mouseX != last.mouseX || frame.mouseY != last.mouseY)
+			flags |= FRAME_MOUSE_POS;
+		if (frame.mouseDeltaX != 0 || frame.mouseDeltaY != 0 || frame.mouseDeltaZ != 0)
+			flags |= FRAME_MOUSE_DELTA;
+		if (!s_vEvents.empty())
+			flags |= FRAME_EVENTS;
+		return flags;
+	}
+
+	// д밴
+	void WriteFrame(const easy2d::InputFrame& frame, BYTE flags)
+	{
+		if (flags & FRAME_DELTA_TIME)
+		{
+			Write(frame.deltaTime);
+		}
+		if (flags & FRAME_MOUSE_BUTTONS)
+		{
+			Write(frame.mouseButtons);
+		}
+		if (flags & FRAME_MOUSE_POS)
+		{
+			Write(frame.mouseX);
+			Write(frame.mouseY);
+		}
+		if (flags & FRAME_MOUSE_DELTA)
+		{
+			Write(frame.mouseDeltaX);
+			Write(frame.mouseDeltaY);
+			Write(frame.mouseDeltaZ);
+		}
+		if (flags & FRAME_EVENTS)
+		{
+			Write(UINT32(s_vEvents.size()));
+			for (const auto& record : s_vEvents)
+			{
+				WriteEvent(record);
+			}
+		}
+	}
+
+	// ȡݣ¼ s_vEvents 
+	bool ReadFrame(easy2d::InputFrame& frame, BYTE flags)
+	{
+		s_vEvents.clear();
+
+		if ((flags & FRAME_DELTA_TIME) && !Read(frame.deltaTime))
+			return false;
+
+		if ((flags & FRAME_MOUSE_BUTTONS) && !Read(frame.mouseButtons))
+			return false;
+
+		if ((flags & FRAME_MOUSE_POS) && !(Read(frame.mouseX) && Read(frame.mouseY)))
+			return false;
+
+		if (flags & FRAME_MOUSE_DELTA)
+		{
+			if (!Read(frame.mouseDeltaX) || !Read(frame.mouseDeltaY) || !Read(frame.mouseDeltaZ))
+				return false;
+		}
+		else
+		{
+			frame.mouseDeltaX = frame.mouseDeltaY = frame.mouseDeltaZ = 0;
+		}
+
+		if (flags & FRAME_EVENTS)
+		{
+			UINT32 count = 0;
+			if (!Read(count))
+				return false;
+
+			EventRecord record;
+			for (UINT32 i = 0; i < count; ++i)
+			{
+				if (!ReadEvent(record))
+					return false;
+
+				s_vEvents.push_back(record);
+			}
+		}
+		return true;
+	}
+}
+
+easy2d::InputFrame::InputFrame()
+	: deltaTime(0)
+	, keys()
+	, mouseButtons(0)
+	, mouseX(0)
+	, mouseY(0)
+	, mouseDeltaX(0)
+	, mouseDeltaY(0)
+	, mouseDeltaZ(0)
+{
+}
+
+bool easy2d::InputRecorder::startRecording(const String& filePath)
+{
+	if (s_bRecording || s_bReplaying)
+	{
+		E2D_WARNING(L"InputRecorder is busy!");
+		return false;
+	}
+
+	s_Output.open(filePath, std::ios::binary | std::ios::trunc);
+	if (!s_Output)
+	{
+		E2D_WARNING(L"InputRecorder::startRecording failed!");
+		s_Output.clear();
+		return false;
+	}
+
+	s_Output.write(REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+	Write(REPLAY_VERSION);
+	Write(UINT32(0));
+
+	s_bRecording = true;
+	s_nFrameIndex = 0;
+	s_LastFrame = InputFrame();
+	s_vEvents.clear();
+	return true;
+}
+
+void easy2d::InputRecorder::stopRecording()
+{
+	if (!s_bRecording)
+		return;
+
+	// д֡
+	s_Output.seekp(REPLAY_FRAME_COUNT_OFFSET);
+	Write(s_nFrameIndex);
+	s_Output.close();
+	s_Output.clear();
+
+	s_bRecording = false;
+	s_vEvents.clear();
+}
+
+bool easy2d::InputRecorder::isRecording()
+{
+	return s_bRecording;
+}
+
+bool easy2d::InputRecorder::startReplay(const String& filePath)
+{
+	if (s_bRecording || s_bReplaying)
+	{
+		E2D_WARNING(L"InputRecorder is busy!");
+		return false;
+	}
+
+	s_Input.open(filePath, std::ios::binary);
+
+	char magic[4] = { 0 };
+	UINT32 version = 0, frameCount = 0;
+	s_Input.read(magic, sizeof(magic));
+	if (!s_Input || ::memcmp(magic, REPLAY_MAGIC, sizeof(magic)) != 0 ||
+		!Read(version) || version != REPLAY_VERSION || !Read(frameCount))
+	{
+		E2D_WARNING(L"InputRecorder::startReplay failed!");
+		s_Input.close();
+		s_Input.clear();
+		return false;
+	}
+
+	s_bReplaying = true;
+	s_nFrameIndex = 0;
+	s_LastFrame = InputFrame();
+	s_Stats.frames = 0;
+	s_Stats.totalTime = 0;
+	s_Stats.maxFrameTime = 0;
+	return true;
+}
+
+void easy2d::InputRecorder::stopReplay()
+{
+	if (!s_bReplaying)
+		return;
+
+	s_Input.close();
+	s_Input.clear();
+	s_bReplaying = false;
+}
+
+bool easy2d::InputRecorder::isReplaying()
+{
+	return s_bReplaying;
+}
+
+void easy2d::InputRecorder::setReplayEndCallback(const Function<void()>& func)
+{
+	s_ReplayEndCallback = func;
+}
+
+bool easy2d::InputRecorder::stepReplay()
+{
+	float dt = 0;
+	if (!InputRecorder::__update(dt) || !s_bReplaying)
+		return false;
+
+	EventQueue::__dispatch();
+	Game::step(dt);
+	GC::clear();
+	return true;
+}
+
+UINT32 easy2d::InputRecorder::getFrameIndex()
+{
+	return s_nFrameIndex;
+}
+
+easy2d::InputRecorder::Stats easy2d::InputRecorder::getStats()
+{
+	return s_Stats;
+}
+
+bool easy2d::InputRecorder::__update(float& dt)
+{
+	if (s_bRecording)
+	{
+		InputFrame frame;
+		Input::__getFrame(frame);
+		frame.deltaTime = dt;
+
+		BYTE flags = GetFrameFlags(frame);
+		Write(flags);
+		if (flags & FRAME_KEYS)
+		{
+			s_Output.write(reinterpret_cast<const char*>(frame.keys._bits), sizeof(frame.keys._bits));
+		}
+		WriteFrame(frame, flags);
+
+		s_LastFrame = frame;
+		s_vEvents.clear();
+		++s_nFrameIndex;
+
+		if (!s_Output)
+		{
+			E2D_WARNING(L"InputRecorder failed to write the record file!");
+			s_Output.clear();
+			InputRecorder::stopRecording();
+		}
+		return true;
+	}
+
+	if (s_bReplaying)
+	{
+		// ͳλط֮ļ
+		steady_clock::time_point now = steady_clock::now();
+		if (s_nFrameIndex > 0)
+		{
+			float frameTime = duration_cast<microseconds>(now - s_tLastFrame).count() / 1000.f / 1000.f;
+			s_Stats.totalTime += frameTime;
+			s_Stats.maxFrameTime = max(s_Stats.maxFrameTime, frameTime);
+		}
+		s_tLastFrame = now;
+
+		BYTE flags = 0;
+		bool succeeded = Read(flags);
+		if (succeeded && (flags & FRAME_KEYS))
+		{
+			s_Input.read(reinterpret_cast<char*>(s_LastFrame.keys._bits), sizeof(s_LastFrame.keys._bits));
+			succeeded = (s_Input.gcount() == sizeof(s_LastFrame.keys._bits));
+		}
+		succeeded = succeeded && ReadFrame(s_LastFrame, flags);
+
+		if (!succeeded)
+		{
+			s_vEvents.clear();
+			InputRecorder::stopReplay();
+
+			// صп¿ʼطţȸһ
+			auto callback = s_ReplayEndCallback;
+			if (callback)
+			{
+				callback();
+			}
+			return false;
+		}
+
+		Input::__setFrame(s_LastFrame);
+		dt = s_LastFrame.deltaTime;
+
+		for (const auto& record : s_vEvents)
+		{
+			EventQueue::__pushReplayed(record.type, record.x, record.y, record.delta, record.code, record.count);
+		}
+		s_vEvents.clear();
+
+		++s_nFrameIndex;
+		s_Stats.frames = s_nFrameIndex;
+		return true;
+	}
+	return false;
+}
+
+void easy2d::InputRecorder::__recordEvent(UINT type, float x, float y, float delta, int code, int count)
+{
+	EventRecord record = { type, x, y, delta, code, count };
+	s_vEvents.push_back(record);
+}
+
+void easy2d::InputRecorder::__uninit()
+{
+	InputRecorder::stopRecording();
+	InputRecorder::stopReplay();
+	s_ReplayEndCallback = nullptr;
+}
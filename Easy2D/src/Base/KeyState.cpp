@@ -0,0 +1,57 @@
+#include <easy2d/e2dbase.h>
+
+easy2d::KeyState::KeyState()
+	: _down()
+	, _pressed()
+	, _released()
+{
+}
+
+void easy2d::KeyState::update(const KeySet& current)
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		UINT32 last = _down._bits[i];
+		UINT32 now = current._bits[i];
+		_pressed._bits[i] = now & ~last;
+		_released._bits[i] = last & ~now;
+		_down._bits[i] = now;
+	}
+}
+
+void easy2d::KeyState::reset()
+{
+	_down.clear();
+	_pressed.clear();
+	_released.clear();
+}
+
+bool easy2d::KeyState::isDown(KeyCode::Value key) const
+{
+	return _down.contains(key);
+}
+
+bool easy2d::KeyState::isPress(KeyCode::Value key) const
+{
+	return _pressed.contains(key);
+}
+
+bool easy2d::KeyState::isRelease(KeyCode::Value key) const
+{
+	return _released.contains(key);
+}
+
+const easy2d::KeySet& easy2d::KeyState::getDown() const
+{
+	return _down;
+}
+
+const easy2d::KeySet& easy2d::KeyState::getPressed() const
+{
+	return _pressed;
+}
+
+const easy2d::KeySet& easy2d::KeyState::getReleased() const
+{
+	return _released;
+}
@@ -1,6 +1,11 @@
 #include <easy2d/e2dbase.h>
 #include <iostream>
 #include <fstream>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
 
 namespace
 {
@@ -13,30 +18,234 @@ namespace
 	std::wfstream s_wconsoleInput, s_wconsoleOutput, s_wconsoleError;
 }
 
-namespace 
+namespace
 {
-	void Output(std::wostream& os, const wchar_t* prompt, const wchar_t* format, va_list args)
+	// ־У߳д룬̶̨߳ȡнУÿλű״̬
+	const size_t LOG_RING_SIZE = 256;
+	const size_t LOG_RING_MASK = LOG_RING_SIZE - 1;
+	const size_t LOG_RECORD_LENGTH = 512;
+
+	struct LogRecord
+	{
+		std::atomic<size_t> sequence;
+		wchar_t text[LOG_RECORD_LENGTH];
+	};
+
+	LogRecord s_Ring[LOG_RING_SIZE];
+	std::atomic<size_t> s_nEnqueuePos(0);
+	size_t s_nDequeuePos = 0;
+	std::atomic<UINT32> s_nDropped(0);
+
+	// ͬһ־Ըʽַ֣ÿĴ
+	const size_t RATE_SLOT_COUNT = 64;
+
+	struct RateSlot
+	{
+		std::atomic<const wchar_t*> format;
+		std::atomic<UINT32> windowStart;
+		std::atomic<UINT32> count;
+		std::atomic<UINT32> suppressed;
+	};
+
+	RateSlot s_RateSlots[RATE_SLOT_COUNT];
+	std::atomic<UINT32> s_nRateLimit(10);
+	const std::chrono::steady_clock::time_point s_tStart = std::chrono::steady_clock::now();
+
+	std::mutex s_OutputMutex;	// ֤ͬһʱֻһ̶߳ȡ
+	std::mutex s_WakeMutex;
+	std::condition_variable s_WakeCond;
+	std::atomic<bool> s_bPending(false);
+	std::thread s_FlushThread;
+	std::atomic<bool> s_bQuit(false);
+	std::once_flag s_StartFlag;
+
+	// ж־Ƿ񳬳Ƶƣ false ʱ
+	// µļڿʼʱͨ suppressed һڱԵĴ
+	bool CheckRate(const wchar_t* format, UINT32& suppressed)
 	{
-		if (s_bEnable)
+		suppressed = 0;
+
+		UINT32 limit = s_nRateLimit.load(std::memory_order_relaxed);
+		if (limit == 0)
+			return true;
+
+		UINT32 now = static_cast<UINT32>(std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now() - s_tStart).count());
+
+		RateSlot& slot = s_RateSlots[(reinterpret_cast<size_t>(format) >> 3) % RATE_SLOT_COUNT];
+		if (slot.format.load(std::memory_order_relaxed) != format)
 		{
-			static wchar_t tempBuffer[1024 * 3 + 1];
+			// ͬ־ͬһλʱֱ滻ֻǽֵ
+			slot.format.store(format, std::memory_order_relaxed);
+			slot.windowStart.store(now, std::memory_order_relaxed);
+			slot.count.store(0, std::memory_order_relaxed);
+			slot.suppressed.store(0, std::memory_order_relaxed);
+		}
+		else if (now - slot.windowStart.load(std::memory_order_relaxed) >= 1000)
+		{
+			slot.windowStart.store(now, std::memory_order_relaxed);
+			slot.count.store(0, std::memory_order_relaxed);
+			suppressed = slot.suppressed.exchange(0, std::memory_order_relaxed);
+		}
+
+		if (slot.count.fetch_add(1, std::memory_order_relaxed) < limit)
+			return true;
 
-			std::wstringstream ss;
+		slot.suppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	// е־
+	void Drain()
+	{
+		std::lock_guard<std::mutex> lock(s_OutputMutex);
+
+		std::wstring output;
+		while (true)
+		{
+			LogRecord& record = s_Ring[s_nDequeuePos & LOG_RING_MASK];
+			if (record.sequence.load(std::memory_order_acquire) != s_nDequeuePos + 1)
+				break;
+
+			output.append(record.text);
+			record.sequence.store(s_nDequeuePos + LOG_RING_SIZE, std::memory_order_release);
+			++s_nDequeuePos;
+		}
+
+		UINT32 dropped = s_nDropped.exchange(0, std::memory_order_relaxed);
+		if (dropped)
+		{
+			output.append(L"Warning: ").append(std::to_wstring(dropped)).append(L" log messages dropped\n");
+		}
+
+		if (!output.empty())
+		{
+			std::wcout << output << std::flush;
+			::OutputDebugStringW(output.c_str());
+		}
+	}
 
-			if (prompt)
-				ss << prompt;
+	void FlushThread()
+	{
+		while (!s_bQuit.load())
+		{
+			{
+				std::unique_lock<std::mutex> lock(s_WakeMutex);
+				s_WakeCond.wait_for(lock, std::chrono::milliseconds(100), []() { return s_bPending.load() || s_bQuit.load(); });
+				s_bPending.store(false);
+			}
+			Drain();
+		}
+		Drain();
+	}
 
-			if (format)
+	void StopFlushThread()
+	{
+		if (s_FlushThread.joinable())
+		{
 			{
-				const auto len = ::_vscwprintf(format, args) + 1;
-				::_vsnwprintf_s(tempBuffer, len, len, format, args);
+				std::lock_guard<std::mutex> lock(s_WakeMutex);
+				s_bQuit.store(true);
+			}
+			s_WakeCond.notify_one();
+			s_FlushThread.join();
+		}
+		Drain();
+	}
 
-				ss << tempBuffer << std::endl;
+	// ˳ʱʣ־̨߳
+	struct LoggerGuard
+	{
+		LoggerGuard()
+		{
+			for (size_t i = 0; i < LOG_RING_SIZE; ++i)
+			{
+				s_Ring[i].sequence.store(i, std::memory_order_relaxed);
 			}
+		}
 
-			std::wstring output = ss.str();
-			os << output << std::flush;
-			::OutputDebugStringW(output.c_str());
+		~LoggerGuard()
+		{
+			StopFlushThread();
+		}
+	} s_LoggerGuard;
+
+	// limited Ϊ false ʱƵƣString ͵ĸʽ̶ַַ޷֣
+	void Output(const wchar_t* prompt, const wchar_t* format, va_list args, bool immediate, bool limited)
+	{
+		if (!s_bEnable || format == nullptr)
+			return;
+
+		UINT32 suppressed = 0;
+		if (limited && !CheckRate(format, suppressed))
+			return;
+
+		// еλãʱ
+		LogRecord* record = nullptr;
+		size_t pos = s_nEnqueuePos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			LogRecord& slot = s_Ring[pos & LOG_RING_MASK];
+			size_t sequence = slot.sequence.load(std::memory_order_acquire);
+			intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+			if (diff == 0)
+			{
+				if (s_nEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					record = &slot;
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				break;
+			}
+			else
+			{
+				pos = s_nEnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		if (record == nullptr)
+		{
+			s_nDropped.fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			// ֱӸʽУ־ᱻض
+			wchar_t* text = record->text;
+			size_t capacity = LOG_RECORD_LENGTH - 1;
+			size_t used = 0;
+			while (prompt[used] && used < capacity)
+			{
+				text[used] = prompt[used];
+				++used;
+			}
+
+			int len = ::_vsnwprintf_s(text + used, capacity - used, _TRUNCATE, format, args);
+			used = len < 0 ? ::wcslen(text) : used + size_t(len);
+
+			if (suppressed && used < capacity)
+			{
+				len = ::_snwprintf_s(text + used, capacity - used, _TRUNCATE, L" (%u similar messages suppressed)", suppressed);
+				used = len < 0 ? ::wcslen(text) : used + size_t(len);
+			}
+			text[used] = L'\n';
+			text[used + 1] = L'\0';
+
+			record->sequence.store(pos + 1, std::memory_order_release);
+		}
+
+		if (immediate)
+		{
+			Drain();
+			return;
+		}
+
+		std::call_once(s_StartFlag, []() { s_FlushThread = std::thread(FlushThread); });
+		if (!s_bPending.exchange(true))
+		{
+			s_WakeCond.notify_one();
 		}
 	}
 
@@ -145,7 +354,17 @@ void easy2d::Logger::messageln(String format, ...)
 	va_list args = nullptr;
 	va_start(args, format);
 
-	Output(std::wcout, L" ", format.c_str(), args);
+	Output(L" ", format.c_str(), args, false, false);
+
+	va_end(args);
+}
+
+void easy2d::Logger::messageln(const wchar_t* format, ...)
+{
+	va_list args = nullptr;
+	va_start(args, format);
+
+	Output(L" ", format, args, false, true);
 
 	va_end(args);
 }
@@ -155,7 +374,17 @@ void easy2d::Logger::warningln(String format, ...)
 	va_list args = nullptr;
 	va_start(args, format);
 
-	Output(std::wcout, L"Warning: ", format.c_str(), args);
+	Output(L"Warning: ", format.c_str(), args, false, false);
+
+	va_end(args);
+}
+
+void easy2d::Logger::warningln(const wchar_t* format, ...)
+{
+	va_list args = nullptr;
+	va_start(args, format);
+
+	Output(L"Warning: ", format, args, false, true);
 
 	va_end(args);
 }
@@ -165,11 +394,31 @@ void easy2d::Logger::errorln(String format, ...)
 	va_list args = nullptr;
 	va_start(args, format);
 
-	Output(std::wcout, L"Error: ", format.c_str(), args);
+	Output(L"Error: ", format.c_str(), args, true, false);
 
 	va_end(args);
 }
 
+void easy2d::Logger::errorln(const wchar_t* format, ...)
+{
+	va_list args = nullptr;
+	va_start(args, format);
+
+	Output(L"Error: ", format, args, true, true);
+
+	va_end(args);
+}
+
+void easy2d::Logger::flush()
+{
+	Drain();
+}
+
+void easy2d::Logger::setRateLimit(UINT32 count)
+{
+	s_nRateLimit.store(count);
+}
+
 void easy2d::Logger::showConsole(bool show)
 {
 	HWND currConsole = ::GetConsoleWindow();
@@ -0,0 +1,220 @@
+#include <easy2d/e2dbase.h>
+#include <chrono>
+using namespace std::chrono;
+
+
+namespace
+{
+	// ֡ʱ¼
+	easy2d::FrameHistory s_History;
+	// ׶εĿʼʱ
+	steady_clock::time_point s_tPhaseStart[easy2d::FrameHistory::PhaseCount];
+	// ǰ֡׶εۼƺʱ룩
+	float s_fPhaseTimes[easy2d::FrameHistory::PhaseCount] = { 0 };
+	// һ֡ʱ
+	steady_clock::time_point s_tLastFrame;
+	bool s_bFirstFrame = true;
+
+	// ϴˢͳ
+	int s_nTextFrames = 0;
+	float s_fTextFrameTime = 0;
+	float s_fTextMaxFrameTime = 0;
+	float s_fTextPhaseTimes[easy2d::FrameHistory::PhaseCount] = { 0 };
+	float s_fLastTextTime = 0;
+	float s_fFps = 0;
+
+	// ֵˢ¼룩
+	const float TEXT_INTERVAL = 0.3f;
+}
+
+
+easy2d::FrameHistory::FrameHistory(size_t capacity)
+	: _head(0)
+	, _count(0)
+	, _frameTimeSum(0)
+	, _samples(max(capacity, size_t(1)))
+{
+	for (int i = 0; i < PhaseCount; ++i)
+	{
+		_phaseTimeSums[i] = 0;
+	}
+}
+
+void easy2d::FrameHistory::push(const Sample & sample)
+{
+	// ʱȥǵļ¼ƽֵҪÿۼ
+	if (_count == _samples.size())
+	{
+		const Sample& oldest = _samples[_head];
+		_frameTimeSum -= oldest.frameTime;
+		for (int i = 0; i < PhaseCount; ++i)
+		{
+			_phaseTimeSums[i] -= oldest.phaseTimes[i];
+		}
+	}
+	else
+	{
+		++_count;
+	}
+
+	_samples[_head] = sample;
+	_frameTimeSum += sample.frameTime;
+	for (int i = 0; i < PhaseCount; ++i)
+	{
+		_phaseTimeSums[i] += sample.phaseTimes[i];
+	}
+	_head = (_head + 1) % _samples.size();
+}
+
+void easy2d::FrameHistory::clear()
+{
+	_head = 0;
+	_count = 0;
+	_frameTimeSum = 0;
+	for (int i = 0; i < PhaseCount; ++i)
+	{
+		_phaseTimeSums[i] = 0;
+	}
+}
+
+size_t easy2d::FrameHistory::getCount() const
+{
+	return _count;
+}
+
+size_t easy2d::FrameHistory::getCapacity() const
+{
+	return _samples.size();
+}
+
+const easy2d::FrameHistory::Sample & easy2d::FrameHistory::get(size_t index) const
+{
+	size_t capacity = _samples.size();
+	return _samples[(_head + capacity - _count + index) % capacity];
+}
+
+easy2d::FrameHistory::Sample easy2d::FrameHistory::getAverage() const
+{
+	Sample average = { 0 };
+	if (_count)
+	{
+		average.frameTime = float(_frameTimeSum / _count);
+		for (int i = 0; i < PhaseCount; ++i)
+		{
+			average.phaseTimes[i] = float(_phaseTimeSums[i] / _count);
+		}
+	}
+	return average;
+}
+
+float easy2d::FrameHistory::getMaxFrameTime() const
+{
+	float maxTime = 0;
+	for (size_t i = 0; i < _count; ++i)
+	{
+		maxTime = max(maxTime, get(i).frameTime);
+	}
+	return maxTime;
+}
+
+
+const easy2d::FrameHistory & easy2d::Profiler::getHistory()
+{
+	return s_History;
+}
+
+float easy2d::Profiler::getFps()
+{
+	return s_fFps;
+}
+
+void easy2d::Profiler::__beginPhase(FrameHistory::Phase phase)
+{
+	s_tPhaseStart[phase] = steady_clock::now();
+}
+
+void easy2d::Profiler::__endPhase(FrameHistory::Phase phase)
+{
+	s_fPhaseTimes[phase] += duration_cast<microseconds>(steady_clock::now() - s_tPhaseStart[phase]).count() / 1000.f;
+}
+
+void easy2d::Profiler::__endFrame()
+{
+	auto now = steady_clock::now();
+	if (s_bFirstFrame)
+	{
+		// һ֡û֡
+		s_bFirstFrame = false;
+		s_tLastFrame = now;
+		for (auto& time : s_fPhaseTimes)
+		{
+			time = 0;
+		}
+		return;
+	}
+
+	FrameHistory::Sample sample;
+	sample.frameTime = duration_cast<microseconds>(now - s_tLastFrame).count() / 1000.f;
+	s_tLastFrame = now;
+
+	s_fTextFrameTime += sample.frameTime;
+	s_fTextMaxFrameTime = max(s_fTextMaxFrameTime, sample.frameTime);
+	for (int i = 0; i < FrameHistory::PhaseCount; ++i)
+	{
+		sample.phaseTimes[i] = s_fPhaseTimes[i];
+		s_fTextPhaseTimes[i] += s_fPhaseTimes[i];
+		s_fPhaseTimes[i] = 0;
+	}
+	++s_nTextFrames;
+
+	s_History.push(sample);
+}
+
+bool easy2d::Profiler::__updateText(float totalTime, String & text)
+{
+	if (totalTime - s_fLastTextTime < TEXT_INTERVAL && !text.empty())
+		return false;
+
+	s_fLastTextTime = totalTime;
+
+	// ʱƽֵʾ
+	float frameTime = 0;
+	float phaseTimes[FrameHistory::PhaseCount] = { 0 };
+	if (s_nTextFrames)
+	{
+		frameTime = s_fTextFrameTime / s_nTextFrames;
+		for (int i = 0; i < FrameHistory::PhaseCount; ++i)
+		{
+			phaseTimes[i] = s_fTextPhaseTimes[i] / s_nTextFrames;
+		}
+	}
+	s_fFps = frameTime > 0 ? 1000.f / frameTime : 0;
+
+	wchar_t buffer[128] = { 0 };
+	::swprintf_s(
+		buffer,
+		L"FPS: %.1f  %.2f ms (max %.2f)\nupdate %.2f  actions %.2f  render %.2f  gc %.2f",
+		s_fFps,
+		frameTime,
+		s_fTextMaxFrameTime,
+		phaseTimes[FrameHistory::Update],
+		phaseTimes[FrameHistory::Actions],
+		phaseTimes[FrameHistory::Render],
+		phaseTimes[FrameHistory::GC]
+	);
+
+	s_nTextFrames = 0;
+	s_fTextFrameTime = 0;
+	s_fTextMaxFrameTime = 0;
+	for (auto& time : s_fTextPhaseTimes)
+	{
+		time = 0;
+	}
+
+	// ֵûб仯ʱҪŰ
+	if (text == buffer)
+		return false;
+
+	text = buffer;
+	return true;
+}
@@ -1,10 +1,311 @@
 #include <easy2d/e2dbase.h>
 #include <easy2d/e2dmanager.h>
 #include <easy2d/e2dnode.h>
+#include <map>
+#include <tuple>
+#include <cmath>
+#include <algorithm>
 
 namespace easy2d
 {
 
+// ʹ Direct2D λͼҳϣͼҳ봰ȾĿݵλͼ
+class D2DGlyphRasterizer
+	: public GlyphRasterizer
+{
+public:
+	D2DGlyphRasterizer(
+		ID2D1Factory* pD2DFactory,
+		ID2D1HwndRenderTarget* pRT
+	);
+
+	virtual ~D2DGlyphRasterizer();
+
+	virtual bool measure(
+		const GlyphKey& key,
+		int& width,
+		int& height,
+		float& originX,
+		float& originY
+	) override;
+
+	virtual bool createPage(
+		int page,
+		int width,
+		int height
+	) override;
+
+	virtual bool draw(
+		const GlyphKey& key,
+		int page,
+		float originX,
+		float originY
+	) override;
+
+	virtual void clearPages() override;
+
+	ID2D1Bitmap* GetPageBitmap(int page) const;
+
+private:
+	ID2D1PathGeometry* GetGlyphGeometry(const GlyphKey& key);
+
+	static ID2D1StrokeStyle* GetStrokeStyle(int lineJoin);
+
+private:
+	ID2D1Factory* pD2DFactory_;
+	ID2D1HwndRenderTarget* pRT_;
+	std::vector<ID2D1BitmapRenderTarget*> pages_;
+	std::vector<ID2D1Bitmap*> bitmaps_;
+	std::vector<ID2D1SolidColorBrush*> brushes_;
+	std::vector<IDWriteFontFace*> fontFaces_;
+	GlyphKey lastKey_;
+	ID2D1PathGeometry* pLastGeometry_;
+};
+
+D2DGlyphRasterizer::D2DGlyphRasterizer(
+	ID2D1Factory* pD2DFactory,
+	ID2D1HwndRenderTarget* pRT
+)
+	: pD2DFactory_(pD2DFactory)
+	, pRT_(pRT)
+	, lastKey_()
+	, pLastGeometry_(nullptr)
+{
+	pD2DFactory_->AddRef();
+	pRT_->AddRef();
+}
+
+D2DGlyphRasterizer::~D2DGlyphRasterizer()
+{
+	clearPages();
+	SafeRelease(pD2DFactory_);
+	SafeRelease(pRT_);
+}
+
+bool D2DGlyphRasterizer::measure(
+	const GlyphKey& key,
+	int& width,
+	int& height,
+	float& originX,
+	float& originY
+)
+{
+	ID2D1PathGeometry* pGeometry = GetGlyphGeometry(key);
+	if (!pGeometry)
+		return false;
+
+	D2D1_RECT_F bounds;
+	HRESULT hr = key.outline > 0
+		? pGeometry->GetWidenedBounds(key.outline, GetStrokeStyle(key.lineJoin), nullptr, &bounds)
+		: pGeometry->GetBounds(nullptr, &bounds);
+
+	if (FAILED(hr))
+		return false;
+
+	if (bounds.right <= bounds.left || bounds.bottom <= bounds.top)
+	{
+		width = height = 0;
+		originX = originY = 0;
+		return true;
+	}
+
+	// ܸһأ⿹ݵıԵõ
+	float left = floorf(bounds.left) - 1;
+	float top = floorf(bounds.top) - 1;
+	width = int(ceilf(bounds.right) - left) + 1;
+	height = int(ceilf(bounds.bottom) - top) + 1;
+	originX = -left;
+	originY = -top;
+	return true;
+}
+
+bool D2DGlyphRasterizer::createPage(
+	int page,
+	int width,
+	int height
+)
+{
+	if (page != int(pages_.size()))
+		return false;
+
+	ID2D1BitmapRenderTarget* pPage = nullptr;
+	ID2D1Bitmap* pBitmap = nullptr;
+	ID2D1SolidColorBrush* pBrush = nullptr;
+
+	// ͼҳʹ봰ȾĿͬ DPIΰĻʵعդ
+	// ͼе DIP ΪλͻʱԴһ
+	float dpiX = 96, dpiY = 96;
+	pRT_->GetDpi(&dpiX, &dpiY);
+
+	HRESULT hr = pRT_->CreateCompatibleRenderTarget(
+		D2D1::SizeF(float(width), float(height)),
+		D2D1::SizeU(UINT32(ceilf(width * dpiX / 96)), UINT32(ceilf(height * dpiY / 96))),
+		D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED),
+		D2D1_COMPATIBLE_RENDER_TARGET_OPTIONS_NONE,
+		&pPage
+	);
+
+	if (SUCCEEDED(hr))
+	{
+		hr = pPage->CreateSolidColorBrush(D2D1::ColorF(D2D1::ColorF::White), &pBrush);
+	}
+
+	if (SUCCEEDED(hr))
+	{
+		pPage->BeginDraw();
+		pPage->Clear(D2D1::ColorF(0, 0, 0, 0));
+		hr = pPage->EndDraw();
+	}
+
+	if (SUCCEEDED(hr))
+	{
+		hr = pPage->GetBitmap(&pBitmap);
+	}
+
+	if (FAILED(hr))
+	{
+		SafeRelease(pBrush);
+		SafeRelease(pPage);
+		return false;
+	}
+
+	pages_.push_back(pPage);
+	bitmaps_.push_back(pBitmap);
+	brushes_.push_back(pBrush);
+	return true;
+}
+
+bool D2DGlyphRasterizer::draw(
+	const GlyphKey& key,
+	int page,
+	float originX,
+	float originY
+)
+{
+	if (page < 0 || page >= int(pages_.size()))
+		return false;
+
+	ID2D1PathGeometry* pGeometry = GetGlyphGeometry(key);
+	if (!pGeometry)
+		return false;
+
+	ID2D1BitmapRenderTarget* pPage = pages_[page];
+	pPage->BeginDraw();
+	pPage->SetTransform(D2D1::Matrix3x2F::Translation(originX, originY));
+
+	// κ߷ֱ𻺴Ϊɫ֣ʱɫ
+	if (key.outline > 0)
+	{
+		pPage->DrawGeometry(pGeometry, brushes_[page], key.outline, GetStrokeStyle(key.lineJoin));
+	}
+	else
+	{
+		pPage->FillGeometry(pGeometry, brushes_[page]);
+	}
+
+	return SUCCEEDED(pPage->EndDraw());
+}
+
+void D2DGlyphRasterizer::clearPages()
+{
+	for (auto pBitmap : bitmaps_)
+		SafeRelease(pBitmap);
+	for (auto pBrush : brushes_)
+		SafeRelease(pBrush);
+	for (auto pPage : pages_)
+		SafeRelease(pPage);
+	for (auto pFontFace : fontFaces_)
+		SafeRelease(pFontFace);
+
+	bitmaps_.clear();
+	brushes_.clear();
+	pages_.clear();
+	fontFaces_.clear();
+	SafeRelease(pLastGeometry_);
+}
+
+ID2D1Bitmap* D2DGlyphRasterizer::GetPageBitmap(int page) const
+{
+	return (page >= 0 && page < int(bitmaps_.size())) ? bitmaps_[page] : nullptr;
+}
+
+ID2D1PathGeometry* D2DGlyphRasterizer::GetGlyphGeometry(const GlyphKey& key)
+{
+	// ŻͬһΣֻһμ״
+	if (pLastGeometry_ && lastKey_.fontFace == key.fontFace && lastKey_.fontSize == key.fontSize && lastKey_.glyph == key.glyph)
+		return pLastGeometry_;
+
+	SafeRelease(pLastGeometry_);
+
+	IDWriteFontFace* pFontFace = static_cast<IDWriteFontFace*>(const_cast<void*>(key.fontFace));
+	if (!pFontFace)
+		return nullptr;
+
+	// е壬ͼǰܱͷ
+	if (std::find(fontFaces_.begin(), fontFaces_.end(), pFontFace) == fontFaces_.end())
+	{
+		pFontFace->AddRef();
+		fontFaces_.push_back(pFontFace);
+	}
+
+	ID2D1PathGeometry* pGeometry = nullptr;
+	ID2D1GeometrySink* pSink = nullptr;
+
+	HRESULT hr = pD2DFactory_->CreatePathGeometry(&pGeometry);
+
+	if (SUCCEEDED(hr))
+	{
+		hr = pGeometry->Open(&pSink);
+	}
+
+	if (SUCCEEDED(hr))
+	{
+		hr = pFontFace->GetGlyphRunOutline(
+			key.fontSize,
+			&key.glyph,
+			nullptr,
+			nullptr,
+			1,
+			FALSE,
+			FALSE,
+			pSink
+		);
+	}
+
+	if (SUCCEEDED(hr))
+	{
+		hr = pSink->Close();
+	}
+
+	SafeRelease(pSink);
+
+	if (FAILED(hr))
+	{
+		SafeRelease(pGeometry);
+		return nullptr;
+	}
+
+	lastKey_ = key;
+	pLastGeometry_ = pGeometry;
+	return pGeometry;
+}
+
+ID2D1StrokeStyle* D2DGlyphRasterizer::GetStrokeStyle(int lineJoin)
+{
+	switch (lineJoin)
+	{
+	case D2D1_LINE_JOIN_MITER:
+		return easy2d::Renderer::getMiterID2D1StrokeStyle();
+	case D2D1_LINE_JOIN_BEVEL:
+		return easy2d::Renderer::getBevelID2D1StrokeStyle();
+	case D2D1_LINE_JOIN_ROUND:
+		return easy2d::Renderer::getRoundID2D1StrokeStyle();
+	default:
+		return nullptr;
+	}
+}
+
+
 // Ⱦ
 class TextRenderer
 	: public IDWriteTextRenderer
@@ -29,6 +330,12 @@ public:
 		D2D1_LINE_JOIN outlineJoin
 		);
 
+	// λ棬Ϊʱʹü״Ⱦ
+	void SetGlyphCache(
+		GlyphCache* pGlyphCache,
+		D2DGlyphRasterizer* pGlyphRasterizer
+	);
+
 	STDMETHOD(DrawGlyphRun)(
 		__maybenull void* clientDrawingContext,
 		FLOAT baselineOriginX,
@@ -88,6 +395,22 @@ public:
 		void** ppvObject
 	);
 
+private:
+	// λлΣ޷ʱʧ
+	HRESULT DrawCachedGlyphRun(
+		FLOAT baselineOriginX,
+		FLOAT baselineOriginY,
+		DWRITE_GLYPH_RUN const* glyphRun
+	);
+
+	// ûˢɫ仺
+	void FillCachedGlyphs(
+		FLOAT baselineOriginX,
+		FLOAT baselineOriginY,
+		DWRITE_GLYPH_RUN const* glyphRun,
+		const std::vector<const GlyphCache::Entry*>& entries
+	);
+
 private:
 	unsigned long cRefCount_;
 	D2D1_COLOR_F sFillColor_;
@@ -98,6 +421,11 @@ private:
 	ID2D1HwndRenderTarget* pRT_;
 	ID2D1SolidColorBrush* pBrush_;
 	ID2D1StrokeStyle* pCurrStrokeStyle_;
+	D2D1_LINE_JOIN outlineJoin_;
+	GlyphCache* pGlyphCache_;
+	D2DGlyphRasterizer* pGlyphRasterizer_;
+	std::vector<const GlyphCache::Entry*> fillEntries_;
+	std::vector<const GlyphCache::Entry*> outlineEntries_;
 };
 
 TextRenderer::TextRenderer()
@@ -110,6 +438,9 @@ TextRenderer::TextRenderer()
 	, fOutlineWidth(1)
 	, bShowOutline_(TRUE)
 	, pCurrStrokeStyle_(nullptr)
+	, outlineJoin_(D2D1_LINE_JOIN_ROUND)
+	, pGlyphCache_(nullptr)
+	, pGlyphRasterizer_(nullptr)
 {
 }
 
@@ -152,6 +483,7 @@ STDMETHODIMP_(void) TextRenderer::SetTextStyle(
 	bShowOutline_ = hasOutline;
 	sOutlineColor_ = outlineColor;
 	fOutlineWidth = 2 * outlineWidth;
+	outlineJoin_ = outlineJoin;
 
 	switch (outlineJoin)
 	{
@@ -182,6 +514,16 @@ STDMETHODIMP TextRenderer::DrawGlyphRun(
 {
 	HRESULT hr = S_OK;
 
+	// źʹȻʹü״Ⱦ
+	if (pGlyphCache_ && !glyphRun->isSideways && glyphRun->bidiLevel % 2 == 0)
+	{
+		hr = DrawCachedGlyphRun(baselineOriginX, baselineOriginY, glyphRun);
+		if (SUCCEEDED(hr))
+		{
+			return hr;
+		}
+	}
+
 	ID2D1PathGeometry* pPathGeometry = nullptr;
 	hr = pD2DFactory_->CreatePathGeometry(
 		&pPathGeometry
@@ -259,6 +601,127 @@ STDMETHODIMP TextRenderer::DrawGlyphRun(
 	return hr;
 }
 
+void TextRenderer::SetGlyphCache(
+	GlyphCache* pGlyphCache,
+	D2DGlyphRasterizer* pGlyphRasterizer
+)
+{
+	pGlyphCache_ = pGlyphCache;
+	pGlyphRasterizer_ = pGlyphRasterizer;
+}
+
+HRESULT TextRenderer::DrawCachedGlyphRun(
+	FLOAT baselineOriginX,
+	FLOAT baselineOriginY,
+	DWRITE_GLYPH_RUN const* glyphRun
+)
+{
+	const UINT32 count = glyphRun->glyphCount;
+	fillEntries_.resize(count);
+	outlineEntries_.resize(bShowOutline_ ? count : 0);
+
+	GlyphKey key;
+	key.fontFace = glyphRun->fontFace;
+	key.fontSize = glyphRun->fontEmSize;
+	key.lineJoin = outlineJoin_;
+
+	// ȡΣͼڴڼ䱻ջʹ֮ǰĽʧЧʱ»ȡһ
+	for (int attempt = 0; ; ++attempt)
+	{
+		int resets = pGlyphCache_->getStats().resets;
+
+		for (UINT32 i = 0; i < count; ++i)
+		{
+			key.glyph = glyphRun->glyphIndices[i];
+
+			key.outline = 0;
+			fillEntries_[i] = pGlyphCache_->get(key);
+			if (!fillEntries_[i])
+				return E_FAIL;
+
+			if (bShowOutline_)
+			{
+				key.outline = fOutlineWidth;
+				outlineEntries_[i] = pGlyphCache_->get(key);
+				if (!outlineEntries_[i])
+					return E_FAIL;
+			}
+		}
+
+		if (resets == pGlyphCache_->getStats().resets)
+			break;
+
+		if (attempt > 0)
+			return E_FAIL;
+	}
+
+	// FillOpacityMask ҪرտݣֱѾݵıԵ
+	D2D1_ANTIALIAS_MODE antialiasMode = pRT_->GetAntialiasMode();
+	pRT_->SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
+
+	if (bShowOutline_)
+	{
+		pBrush_->SetColor(sOutlineColor_);
+		FillCachedGlyphs(baselineOriginX, baselineOriginY, glyphRun, outlineEntries_);
+	}
+
+	pBrush_->SetColor(sFillColor_);
+	FillCachedGlyphs(baselineOriginX, baselineOriginY, glyphRun, fillEntries_);
+
+	pRT_->SetAntialiasMode(antialiasMode);
+	return S_OK;
+}
+
+void TextRenderer::FillCachedGlyphs(
+	FLOAT baselineOriginX,
+	FLOAT baselineOriginY,
+	DWRITE_GLYPH_RUN const* glyphRun,
+	const std::vector<const GlyphCache::Entry*>& entries
+)
+{
+	FLOAT penX = baselineOriginX;
+	for (UINT32 i = 0; i < glyphRun->glyphCount; ++i)
+	{
+		const GlyphCache::Entry* entry = entries[i];
+		if (entry->width > 0)
+		{
+			FLOAT x = penX;
+			FLOAT y = baselineOriginY;
+			if (glyphRun->glyphOffsets)
+			{
+				x += glyphRun->glyphOffsets[i].advanceOffset;
+				y -= glyphRun->glyphOffsets[i].ascenderOffset;
+			}
+
+			D2D1_RECT_F dest = D2D1::RectF(
+				x - entry->originX,
+				y - entry->originY,
+				x - entry->originX + entry->width,
+				y - entry->originY + entry->height
+			);
+			D2D1_RECT_F src = D2D1::RectF(
+				FLOAT(entry->x),
+				FLOAT(entry->y),
+				FLOAT(entry->x + entry->width),
+				FLOAT(entry->y + entry->height)
+			);
+
+			pRT_->FillOpacityMask(
+				pGlyphRasterizer_->GetPageBitmap(entry->page),
+				pBrush_,
+				D2D1_OPACITY_MASK_CONTENT_GRAPHICS,
+				&dest,
+				&src
+			);
+		}
+
+		if (glyphRun->glyphAdvances)
+		{
+			penX += glyphRun->glyphAdvances[i];
+		}
+	}
+}
+
 STDMETHODIMP TextRenderer::DrawUnderline(
 	__maybenull void* clientDrawingContext,
 	FLOAT baselineOriginX,
@@ -502,6 +965,55 @@ namespace
 	ID2D1StrokeStyle* s_pBevelStrokeStyle = nullptr;
 	ID2D1StrokeStyle* s_pRoundStrokeStyle = nullptr;
 	D2D1_COLOR_F s_nClearColor = D2D1::ColorF(D2D1::ColorF::Black);
+
+	// ֺͲֵֻ֣仯ʱ´
+	easy2d::String s_sOverlayText;
+	IDWriteTextLayout* s_pOverlayLayout = nullptr;
+	float s_fOverlayTextHeight = 0;
+
+	// ָʽ棬塢ֺšϸֵǷб
+	typedef std::tuple<easy2d::String, float, UINT, bool> TextFormatKey;
+	std::map<TextFormatKey, IDWriteTextFormat*> s_mTextFormats;
+
+	// λ棬豸Դһ𴴽ͷ
+	bool s_bGlyphCache = false;
+	easy2d::D2DGlyphRasterizer* s_pGlyphRasterizer = nullptr;
+	easy2d::GlyphCache* s_pGlyphCache = nullptr;
+
+	void CreateGlyphCache()
+	{
+		if (s_pGlyphCache || !s_pRenderTarget || !s_pTextRenderer)
+			return;
+
+		s_pGlyphRasterizer = new (std::nothrow) easy2d::D2DGlyphRasterizer(s_pDirect2dFactory, s_pRenderTarget);
+		if (s_pGlyphRasterizer)
+		{
+			s_pGlyphCache = new (std::nothrow) easy2d::GlyphCache(s_pGlyphRasterizer);
+		}
+
+		if (s_pGlyphCache)
+		{
+			s_pTextRenderer->SetGlyphCache(s_pGlyphCache, s_pGlyphRasterizer);
+		}
+		else
+		{
+			delete s_pGlyphRasterizer;
+			s_pGlyphRasterizer = nullptr;
+		}
+	}
+
+	void DiscardGlyphCache()
+	{
+		if (s_pTextRenderer)
+		{
+			s_pTextRenderer->SetGlyphCache(nullptr, nullptr);
+		}
+
+		delete s_pGlyphCache;
+		s_pGlyphCache = nullptr;
+		delete s_pGlyphRasterizer;
+		s_pGlyphRasterizer = nullptr;
+	}
 }
 
 bool easy2d::Renderer::__createDeviceIndependentResources()
@@ -667,6 +1179,11 @@ bool easy2d::Renderer::__createDeviceResources()
 				s_pSolidBrush
 			);
 		}
+
+		if (s_bGlyphCache)
+		{
+			CreateGlyphCache();
+		}
 	}
 
 	return SUCCEEDED(hr);
@@ -674,6 +1191,7 @@ bool easy2d::Renderer::__createDeviceResources()
 
 void easy2d::Renderer::__discardDeviceResources()
 {
+	DiscardGlyphCache();
 	SafeRelease(s_pRenderTarget);
 	SafeRelease(s_pSolidBrush);
 	SafeRelease(s_pTextRenderer);
@@ -685,6 +1203,13 @@ void easy2d::Renderer::__discardDeviceResources()
 void easy2d::Renderer::__discardResources()
 {
 	__discardDeviceResources();
+	for (auto& pair : s_mTextFormats)
+	{
+		SafeRelease(pair.second);
+	}
+	s_mTextFormats.clear();
+	SafeRelease(s_pOverlayLayout);
+	s_sOverlayText.clear();
 	SafeRelease(s_pTextFormat);
 	SafeRelease(s_pDirect2dFactory);
 	SafeRelease(s_pIWICFactory);
@@ -706,52 +1231,10 @@ void easy2d::Renderer::__render()
 	// Ⱦ
 	SceneManager::__render();
 
-	// Ⱦ FPS
+	// Ⱦ
 	if (s_bShowFps && s_pTextFormat)
 	{
-		static int s_nRenderTimes = 0;
-		static float s_fLastRenderTime = 0;
-		static String s_sFpsText;
-
-		++s_nRenderTimes;
-
-		float fDelay = Time::getTotalTime() - s_fLastRenderTime;
-		if (fDelay >= 0.3)
-		{
-			wchar_t fpsText[20] = { 0 };
-			::swprintf_s(fpsText, L"FPS: %.1lf", (1 / fDelay) * s_nRenderTimes);
-			s_sFpsText = fpsText;
-			s_fLastRenderTime = Time::getTotalTime();
-			s_nRenderTimes = 0;
-		}
-
-		IDWriteTextLayout * pTextLayout = nullptr;
-
-		hr = s_pDWriteFactory->CreateTextLayout(
-			s_sFpsText.c_str(),
-			(UINT32)s_sFpsText.length(),
-			s_pTextFormat,
-			0,
-			0,
-			&pTextLayout
-		);
-
-		if (SUCCEEDED(hr))
-		{
-			s_pRenderTarget->SetTransform(D2D1::Matrix3x2F::Identity());
-			s_pSolidBrush->SetOpacity(1.0f);
-			s_pTextRenderer->SetTextStyle(
-				D2D1::ColorF(D2D1::ColorF::White),
-				TRUE,
-				D2D1::ColorF(D2D1::ColorF::Black, 0.4f),
-				1.5f,
-				D2D1_LINE_JOIN_ROUND
-			);
-
-			pTextLayout->Draw(nullptr, s_pTextRenderer, 10, 0);
-
-			SafeRelease(pTextLayout);
-		}
+		Renderer::__renderOverlay();
 	}
 
 	// ֹȾ
@@ -772,6 +1255,98 @@ void easy2d::Renderer::__render()
 }
 
 
+void easy2d::Renderer::__renderOverlay()
+{
+	// ÿ 0.3 ˢһΣֵʱʹԭĲ
+	if (Profiler::__updateText(Time::getTotalTime(), s_sOverlayText) || !s_pOverlayLayout)
+	{
+		SafeRelease(s_pOverlayLayout);
+
+		HRESULT hr = s_pDWriteFactory->CreateTextLayout(
+			s_sOverlayText.c_str(),
+			(UINT32)s_sOverlayText.length(),
+			s_pTextFormat,
+			0,
+			0,
+			&s_pOverlayLayout
+		);
+
+		if (FAILED(hr))
+			return;
+
+		DWRITE_TEXT_METRICS metrics;
+		s_pOverlayLayout->GetMetrics(&metrics);
+		s_fOverlayTextHeight = metrics.height;
+	}
+
+	s_pRenderTarget->SetTransform(D2D1::Matrix3x2F::Identity());
+	s_pSolidBrush->SetOpacity(1.0f);
+	s_pTextRenderer->SetTextStyle(
+		D2D1::ColorF(D2D1::ColorF::White),
+		TRUE,
+		D2D1::ColorF(D2D1::ColorF::Black, 0.4f),
+		1.5f,
+		D2D1_LINE_JOIN_ROUND
+	);
+	s_pOverlayLayout->Draw(nullptr, s_pTextRenderer, 10, 0);
+
+	const FrameHistory& history = Profiler::getHistory();
+	const float frameBudget = 1000.f / 60;		// 60 ֡ʱÿ֡ĺʱ
+	const float graphWidth = float(history.getCapacity());
+	const float graphHeight = 60;
+	const float left = 10;
+	const float top = s_fOverlayTextHeight + 4;
+
+	// ֡ʱߣÿ֡һؿʾ֡ĺʱ
+	s_pSolidBrush->SetColor(D2D1::ColorF(D2D1::ColorF::Black, 0.5f));
+	s_pRenderTarget->FillRectangle(D2D1::RectF(left, top, left + graphWidth, top + graphHeight), s_pSolidBrush);
+
+	const float bottom = top + graphHeight;
+	const float scale = graphHeight / (frameBudget * 2);
+	for (size_t i = 0; i < history.getCount(); ++i)
+	{
+		float frameTime = history.get(i).frameTime;
+		if (frameTime <= frameBudget * 1.1f)
+			s_pSolidBrush->SetColor(D2D1::ColorF(0x4CAF50));
+		else if (frameTime <= frameBudget * 2)
+			s_pSolidBrush->SetColor(D2D1::ColorF(0xFFC107));
+		else
+			s_pSolidBrush->SetColor(D2D1::ColorF(0xF44336));
+
+		float x = left + float(i);
+		float height = min(frameTime * scale, graphHeight);
+		s_pRenderTarget->FillRectangle(D2D1::RectF(x, bottom - height, x + 1, bottom), s_pSolidBrush);
+	}
+
+	// 16.7 ο
+	s_pSolidBrush->SetColor(D2D1::ColorF(D2D1::ColorF::White, 0.6f));
+	s_pRenderTarget->FillRectangle(D2D1::RectF(left, bottom - frameBudget * scale, left + graphWidth, bottom - frameBudget * scale + 1), s_pSolidBrush);
+
+	// ׶εƽʱ updateactionsrendergc ˳ѵȱʾһ֡Ԥ
+	static const UINT32 phaseColors[FrameHistory::PhaseCount] = { 0x03A9F4, 0xFFEB3B, 0xE91E63, 0xFF9800 };
+
+	FrameHistory::Sample average = history.getAverage();
+	float barTop = bottom + 4;
+	float barBottom = barTop + 8;
+	float barScale = graphWidth / frameBudget;
+	float x = left;
+
+	s_pSolidBrush->SetColor(D2D1::ColorF(D2D1::ColorF::Black, 0.5f));
+	s_pRenderTarget->FillRectangle(D2D1::RectF(left, barTop, left + graphWidth, barBottom), s_pSolidBrush);
+
+	for (int i = 0; i < FrameHistory::PhaseCount; ++i)
+	{
+		float width = min(average.phaseTimes[i] * barScale, left + graphWidth - x);
+		if (width <= 0)
+			continue;
+
+		s_pSolidBrush->SetColor(D2D1::ColorF(phaseColors[i]));
+		s_pRenderTarget->FillRectangle(D2D1::RectF(x, barTop, x + width, barBottom), s_pSolidBrush);
+		x += width;
+	}
+}
+
+
 easy2d::Color easy2d::Renderer::getBackgroundColor()
 {
 	return Color(s_nClearColor.r, s_nClearColor.g, s_nClearColor.b, s_nClearColor.a);
@@ -787,6 +1362,31 @@ void easy2d::Renderer::showFps(bool show)
 	s_bShowFps = show;
 }
 
+void easy2d::Renderer::enableGlyphCache(bool enable)
+{
+	s_bGlyphCache = enable;
+
+	if (enable)
+	{
+		CreateGlyphCache();
+	}
+	else
+	{
+		DiscardGlyphCache();
+	}
+}
+
+easy2d::GlyphCache::Stats easy2d::Renderer::getGlyphCacheStats()
+{
+	if (s_pGlyphCache)
+	{
+		return s_pGlyphCache->getStats();
+	}
+
+	GlyphCache::Stats stats = { 0 };
+	return stats;
+}
+
 float easy2d::Renderer::getDpiScaleX()
 {
 	return s_fDpiScaleX;
@@ -822,6 +1422,42 @@ IDWriteFactory * easy2d::Renderer::getIDWriteFactory()
 	return s_pDWriteFactory;
 }
 
+IDWriteTextFormat * easy2d::Renderer::getTextFormat(const Font & font)
+{
+	TextFormatKey key(font.family, font.size, font.weight, font.italic);
+	auto iter = s_mTextFormats.find(key);
+	if (iter != s_mTextFormats.end())
+	{
+		return iter->second;
+	}
+
+	if (!s_pDWriteFactory)
+	{
+		return nullptr;
+	}
+
+	IDWriteTextFormat * textFormat = nullptr;
+	HRESULT hr = s_pDWriteFactory->CreateTextFormat(
+		font.family.c_str(),
+		nullptr,
+		DWRITE_FONT_WEIGHT(font.weight),
+		font.italic ? DWRITE_FONT_STYLE_ITALIC : DWRITE_FONT_STYLE_NORMAL,
+		DWRITE_FONT_STRETCH_NORMAL,
+		font.size,
+		L"",
+		&textFormat
+	);
+
+	if (FAILED(hr))
+	{
+		E2D_WARNING(L"Renderer::getTextFormat error : Create IDWriteTextFormat failed!");
+		return nullptr;
+	}
+
+	s_mTextFormats.insert(std::make_pair(key, textFormat));
+	return textFormat;
+}
+
 void easy2d::Renderer::SetTextStyle(const Color& fillColor, bool hasOutline, const Color& outlineColor, float outlineWidth, LineJoin outlineJoin)
 {
 	s_pTextRenderer->SetTextStyle(
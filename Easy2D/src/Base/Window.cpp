@@ -270,16 +270,14 @@ LRESULT easy2d::Window::WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM l
 	case WM_KEYDOWN:
 	case WM_SYSKEYDOWN:
 	{
-		KeyDownEvent evt(KeyCode::Value(wParam), int(lParam & 0xFF));
-		SceneManager::dispatch(&evt);
+		EventQueue::pushKeyDown(KeyCode::Value(wParam), int(lParam & 0xFF));
 	}
 	break;
 
 	case WM_KEYUP:
 	case WM_SYSKEYUP:
 	{
-		KeyUpEvent evt(KeyCode::Value(wParam), int(lParam & 0xFF));
-		SceneManager::dispatch(&evt);
+		EventQueue::pushKeyUp(KeyCode::Value(wParam), int(lParam & 0xFF));
 	}
 	break;
 
@@ -292,12 +290,11 @@ LRESULT easy2d::Window::WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM l
 		else if (message == WM_RBUTTONUP) { btn = MouseCode::Right; }
 		else if (message == WM_MBUTTONUP) { btn = MouseCode::Middle; }
 
-		MouseUpEvent evt(
+		EventQueue::pushMouseUp(
 			static_cast<float>(GET_X_LPARAM(lParam)),
 			static_cast<float>(GET_Y_LPARAM(lParam)),
 			btn
 		);
-		SceneManager::dispatch(&evt);
 	}
 	break;
 
@@ -310,33 +307,30 @@ LRESULT easy2d::Window::WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM l
 		else if (message == WM_RBUTTONDOWN) { btn = MouseCode::Right; }
 		else if (message == WM_MBUTTONDOWN) { btn = MouseCode::Middle; }
 
-		MouseDownEvent evt(
+		EventQueue::pushMouseDown(
 			static_cast<float>(GET_X_LPARAM(lParam)),
 			static_cast<float>(GET_Y_LPARAM(lParam)),
 			btn
 		);
-		SceneManager::dispatch(&evt);
 	}
 	break;
 
 	case WM_MOUSEMOVE:
 	{
-		MouseMoveEvent evt(
+		EventQueue::pushMouseMove(
 			static_cast<float>(GET_X_LPARAM(lParam)),
 			static_cast<float>(GET_Y_LPARAM(lParam))
 		);
-		SceneManager::dispatch(&evt);
 	}
 	break;
 
 	case WM_MOUSEWHEEL:
 	{
-		MouseWheelEvent evt(
+		EventQueue::pushMouseWheel(
 			static_cast<float>(GET_X_LPARAM(lParam)),
 			static_cast<float>(GET_Y_LPARAM(lParam)),
 			GET_WHEEL_DELTA_WPARAM(wParam) / (float)WHEEL_DELTA
 		);
-		SceneManager::dispatch(&evt);
 	}
 	break;
 
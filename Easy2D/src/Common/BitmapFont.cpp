@@ -0,0 +1,415 @@
+#include <easy2d/e2dcommon.h>
+#include <easy2d/e2dbase.h>
+#include <easy2d/e2dtool.h>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+	typedef std::vector<std::pair<std::string, std::string>> Attributes;
+
+	// ļеһУʽΪ tag key=value key="value" ...
+	void ParseLine(const char* begin, const char* end, std::string& tag, Attributes& attrs)
+	{
+		tag.clear();
+		attrs.clear();
+
+		const char* p = begin;
+		while (p < end && *p != ' ' && *p != '\t')
+			++p;
+		tag.assign(begin, p);
+
+		while (p < end)
+		{
+			while (p < end && (*p == ' ' || *p == '\t'))
+				++p;
+
+			const char* keyBegin = p;
+			while (p < end && *p != '=' && *p != ' ' && *p != '\t')
+				++p;
+			if (p == keyBegin)
+				break;
+
+			std::string key(keyBegin, p);
+			std::string value;
+			if (p < end && *p == '=')
+			{
+				++p;
+				if (p < end && *p == '"')
+				{
+					const char* valueBegin = ++p;
+					while (p < end && *p != '"')
+						++p;
+					value.assign(valueBegin, p);
+					if (p < end)
+						++p;
+				}
+				else
+				{
+					const char* valueBegin = p;
+					while (p < end && *p != ' ' && *p != '\t')
+						++p;
+					value.assign(valueBegin, p);
+				}
+			}
+			attrs.push_back(std::make_pair(key, value));
+		}
+	}
+
+	const std::string* FindAttribute(const Attributes& attrs, const char* key)
+	{
+		for (const auto& attr : attrs)
+		{
+			if (attr.first == key)
+				return &attr.second;
+		}
+		return nullptr;
+	}
+
+	int GetInt(const Attributes& attrs, const char* key, int defaultValue = 0)
+	{
+		auto value = FindAttribute(attrs, key);
+		return value ? atoi(value->c_str()) : defaultValue;
+	}
+
+	// ȡļڵļУĩβķָ
+	easy2d::String GetFolder(const easy2d::String& filePath)
+	{
+		size_t pos = filePath.find_last_of(L"\\/");
+		return pos == easy2d::String::npos ? easy2d::String() : filePath.substr(0, pos + 1);
+	}
+}
+
+easy2d::BitmapFont::BitmapFont()
+	: _lineHeight(0)
+	, _base(0)
+	, _pageCount(0)
+{
+	::memset(_asciiGlyphs, -1, sizeof(_asciiGlyphs));
+}
+
+easy2d::BitmapFont::BitmapFont(const String & filePath)
+	: _lineHeight(0)
+	, _base(0)
+	, _pageCount(0)
+{
+	::memset(_asciiGlyphs, -1, sizeof(_asciiGlyphs));
+	this->open(filePath);
+}
+
+easy2d::BitmapFont::~BitmapFont()
+{
+	for (auto page : _pages)
+	{
+		GC::release(page);
+	}
+}
+
+bool easy2d::BitmapFont::open(const String & filePath)
+{
+	bool succeeded = false;
+
+	// ȴѹصԴм
+	Resource::Data data = Package::find(filePath);
+	if (data.isValid())
+	{
+		succeeded = parse(data.buffer, static_cast<size_t>(data.size));
+	}
+	else
+	{
+		std::ifstream file(filePath, std::ios::binary);
+		if (!file)
+		{
+			E2D_WARNING(L"BitmapFont::open failed! File not found : %s", filePath.c_str());
+			return false;
+		}
+		std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		succeeded = parse(buffer.data(), buffer.size());
+	}
+
+	if (!succeeded)
+	{
+		E2D_WARNING(L"BitmapFont::open failed! Invalid font file : %s", filePath.c_str());
+		return false;
+	}
+
+	// ļõ
+	String folder = GetFolder(filePath);
+	for (size_t i = 0; i < _pageFiles.size(); ++i)
+	{
+		if (_pageFiles[i].empty())
+			continue;
+
+		Image * image = gcnew Image;
+		if (!image->open(folder + _pageFiles[i]))
+		{
+			// ͼƬ gcnew ڴػ
+			E2D_WARNING(L"BitmapFont::open failed! Load page failed : %s", _pageFiles[i].c_str());
+			return false;
+		}
+		this->setPage(int(i), image);
+	}
+	return true;
+}
+
+bool easy2d::BitmapFont::parse(const void * data, size_t size)
+{
+	if (!data || !size)
+		return false;
+
+	_lineHeight = 0;
+	_base = 0;
+	_pageCount = 0;
+	::memset(_asciiGlyphs, -1, sizeof(_asciiGlyphs));
+	_glyphs.clear();
+	_glyphIndices.clear();
+	_kernings.clear();
+	_pageFiles.clear();
+
+	const char* p = static_cast<const char*>(data);
+	const char* end = p + size;
+
+	//  UTF-8 BOM
+	if (size >= 3 && BYTE(p[0]) == 0xEF && BYTE(p[1]) == 0xBB && BYTE(p[2]) == 0xBF)
+		p += 3;
+
+	bool hasCommon = false;
+	std::string tag;
+	Attributes attrs;
+	while (p < end)
+	{
+		const char* lineEnd = p;
+		while (lineEnd < end && *lineEnd != '\n')
+			++lineEnd;
+
+		const char* next = lineEnd < end ? lineEnd + 1 : end;
+		if (lineEnd > p && lineEnd[-1] == '\r')
+			--lineEnd;
+
+		ParseLine(p, lineEnd, tag, attrs);
+		p = next;
+
+		if (tag == "common")
+		{
+			hasCommon = true;
+			_lineHeight = float(GetInt(attrs, "lineHeight"));
+			_base = float(GetInt(attrs, "base"));
+			_pageCount = GetInt(attrs, "pages");
+
+			// ÿҳҪռһҳܳļС𻵵ļڴ
+			if (_pageCount < 0 || size_t(_pageCount) > size / 8)
+				return false;
+		}
+		else if (tag == "page")
+		{
+			int id = GetInt(attrs, "id", -1);
+			auto file = FindAttribute(attrs, "file");
+			if (id < 0 || id >= _pageCount || !file)
+				continue;
+
+			if (_pageFiles.size() <= size_t(id))
+				_pageFiles.resize(id + 1);
+			_pageFiles[id] = NarrowToWide(*file);
+		}
+		else if (tag == "char")
+		{
+			int id = GetInt(attrs, "id", -1);
+			if (id < 0)
+				continue;
+
+			Glyph glyph;
+			glyph.rect = Rect(
+				float(GetInt(attrs, "x")),
+				float(GetInt(attrs, "y")),
+				float(GetInt(attrs, "width")),
+				float(GetInt(attrs, "height"))
+			);
+			glyph.offsetX = float(GetInt(attrs, "xoffset"));
+			glyph.offsetY = float(GetInt(attrs, "yoffset"));
+			glyph.advance = float(GetInt(attrs, "xadvance"));
+			glyph.page = GetInt(attrs, "page");
+			_addGlyph(UINT32(id), glyph);
+		}
+		else if (tag == "kerning")
+		{
+			UINT64 first = UINT32(GetInt(attrs, "first"));
+			UINT64 second = UINT32(GetInt(attrs, "second"));
+			int amount = GetInt(attrs, "amount");
+			if (amount)
+			{
+				_kernings[(first << 32) | second] = float(amount);
+			}
+		}
+	}
+
+	return hasCommon && !_glyphs.empty();
+}
+
+void easy2d::BitmapFont::setPage(int id, Image * image)
+{
+	if (id < 0 || (_pageCount > 0 && id >= _pageCount))
+	{
+		E2D_WARNING(L"BitmapFont::setPage failed! Invalid page id : %d", id);
+		return;
+	}
+
+	if (_pages.size() <= size_t(id))
+		_pages.resize(id + 1, nullptr);
+
+	if (image != _pages[id])
+	{
+		GC::release(_pages[id]);
+		_pages[id] = image;
+		if (image)
+			image->retain();
+	}
+}
+
+easy2d::Image * easy2d::BitmapFont::getPage(int id) const
+{
+	if (id < 0 || size_t(id) >= _pages.size())
+		return nullptr;
+	return _pages[id];
+}
+
+int easy2d::BitmapFont::getPageCount() const
+{
+	return int(max(_pages.size(), _pageFiles.size()));
+}
+
+const easy2d::BitmapFont::Glyph * easy2d::BitmapFont::getGlyph(UINT32 ch) const
+{
+	if (ch < 128)
+	{
+		int index = _asciiGlyphs[ch];
+		return index < 0 ? nullptr : &_glyphs[index];
+	}
+
+	auto iter = _glyphIndices.find(ch);
+	return iter == _glyphIndices.end() ? nullptr : &_glyphs[iter->second];
+}
+
+float easy2d::BitmapFont::getKerning(UINT32 first, UINT32 second) const
+{
+	if (_kernings.empty())
+		return 0;
+
+	auto iter = _kernings.find((UINT64(first) << 32) | second);
+	return iter == _kernings.end() ? 0 : iter->second;
+}
+
+float easy2d::BitmapFont::getLineHeight() const
+{
+	return _lineHeight;
+}
+
+float easy2d::BitmapFont::getBase() const
+{
+	return _base;
+}
+
+easy2d::Size easy2d::BitmapFont::layout(const String & text, std::vector<Quad>& quads, float alignment) const
+{
+	quads.clear();
+	quads.reserve(text.size());
+
+	// ÿеһε±п
+	std::vector<std::pair<size_t, float>> lines;
+
+	const Glyph * fallback = getGlyph(L'?');
+	float penX = 0;
+	float penY = 0;
+	float maxWidth = 0;
+	size_t lineStart = 0;
+	UINT32 prev = 0;
+
+	for (size_t i = 0; i < text.size(); ++i)
+	{
+		UINT32 ch = UINT32(text[i]);
+
+		//  UTF-16 
+		if (ch >= 0xD800 && ch <= 0xDBFF && i + 1 < text.size())
+		{
+			UINT32 low = UINT32(text[i + 1]);
+			if (low >= 0xDC00 && low <= 0xDFFF)
+			{
+				ch = 0x10000 + ((ch - 0xD800) << 10) + (low - 0xDC00);
+				++i;
+			}
+		}
+
+		if (ch == L'\r')
+			continue;
+
+		if (ch == L'\n')
+		{
+			lines.push_back(std::make_pair(lineStart, penX));
+			maxWidth = max(maxWidth, penX);
+			lineStart = quads.size();
+			penX = 0;
+			penY += _lineHeight;
+			prev = 0;
+			continue;
+		}
+
+		const Glyph * glyph = getGlyph(ch);
+		if (!glyph)
+		{
+			glyph = fallback;
+			if (!glyph)
+				continue;
+		}
+
+		if (prev)
+		{
+			penX += getKerning(prev, ch);
+		}
+
+		if (glyph->rect.size.width > 0 && glyph->rect.size.height > 0)
+		{
+			Quad quad;
+			quad.src = glyph->rect;
+			quad.dest = Rect(penX + glyph->offsetX, penY + glyph->offsetY, glyph->rect.size.width, glyph->rect.size.height);
+			quad.page = glyph->page;
+			quads.push_back(quad);
+		}
+
+		penX += glyph->advance;
+		prev = ch;
+	}
+
+	lines.push_back(std::make_pair(lineStart, penX));
+	maxWidth = max(maxWidth, penX);
+
+	// ְһж
+	if (alignment != 0 && lines.size() > 1)
+	{
+		for (size_t i = 0; i < lines.size(); ++i)
+		{
+			size_t first = lines[i].first;
+			size_t last = (i + 1 < lines.size()) ? lines[i + 1].first : quads.size();
+			float offset = (maxWidth - lines[i].second) * alignment;
+			for (size_t j = first; j < last; ++j)
+			{
+				quads[j].dest.origin.x += offset;
+			}
+		}
+	}
+
+	return Size(maxWidth, _lineHeight * lines.size());
+}
+
+void easy2d::BitmapFont::_addGlyph(UINT32 ch, const Glyph & glyph)
+{
+	int index = int(_glyphs.size());
+	_glyphs.push_back(glyph);
+
+	if (ch < 128)
+	{
+		_asciiGlyphs[ch] = index;
+	}
+	else
+	{
+		_glyphIndices[ch] = index;
+	}
+}
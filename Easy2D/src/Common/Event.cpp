@@ -54,3 +54,8 @@ easy2d::KeyUpEvent::KeyUpEvent(KeyCode::Value key, int count)
 	, count(count)
 {
 }
+
+UINT easy2d::EventMask::of(UINT type)
+{
+	return type <= Event::Last ? (1u << type) : EventMask::Custom;
+}
@@ -7,6 +7,85 @@ namespace
 {
 	std::map<size_t, ID2D1Bitmap*> s_mBitmapsFromFile;
 	std::map<int, ID2D1Bitmap*> s_mBitmapsFromResource;
+	std::vector<ID2D1Bitmap*> s_vBitmapsFromAtlas;
+
+	// ڴеͼƬļݴλͼ
+	HRESULT CreateBitmapFromMemory(const void * data, DWORD size, ID2D1Bitmap ** ppBitmap)
+	{
+		HRESULT hr = S_OK;
+
+		IWICBitmapDecoder *pDecoder = nullptr;
+		IWICBitmapFrameDecode *pSource = nullptr;
+		IWICStream *pStream = nullptr;
+		IWICFormatConverter *pConverter = nullptr;
+
+		//  WIC 
+		hr = easy2d::Renderer::getIWICImagingFactory()->CreateStream(&pStream);
+
+		if (SUCCEEDED(hr))
+		{
+			// ʼ
+			hr = pStream->InitializeFromMemory(
+				reinterpret_cast<BYTE*>(const_cast<void*>(data)),
+				size
+			);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			// Ľ
+			hr = easy2d::Renderer::getIWICImagingFactory()->CreateDecoderFromStream(
+				pStream,
+				nullptr,
+				WICDecodeMetadataCacheOnLoad,
+				&pDecoder
+			);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			// ʼ
+			hr = pDecoder->GetFrame(0, &pSource);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			// ͼƬʽת
+			// (DXGI_FORMAT_B8G8R8A8_UNORM + D2D1_ALPHA_MODE_PREMULTIPLIED).
+			hr = easy2d::Renderer::getIWICImagingFactory()->CreateFormatConverter(&pConverter);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			// ͼƬʽת 32bppPBGRA
+			hr = pConverter->Initialize(
+				pSource,
+				GUID_WICPixelFormat32bppPBGRA,
+				WICBitmapDitherTypeNone,
+				nullptr,
+				0.f,
+				WICBitmapPaletteTypeMedianCut
+			);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			//  WIC λͼһ Direct2D λͼ
+			hr = easy2d::Renderer::getRenderTarget()->CreateBitmapFromWicBitmap(
+				pConverter,
+				nullptr,
+				ppBitmap
+			);
+		}
+
+		// ͷԴ
+		SafeRelease(pDecoder);
+		SafeRelease(pSource);
+		SafeRelease(pStream);
+		SafeRelease(pConverter);
+
+		return hr;
+	}
 }
 
 easy2d::Image::Image()
@@ -45,6 +124,14 @@ easy2d::Image::Image(int resNameId, const String& resType, const Rect& cropRect)
 	this->crop(cropRect);
 }
 
+easy2d::Image::Image(ID2D1Bitmap * bitmap, const Rect& cropRect)
+	: _bitmap(nullptr)
+	, _cropRect()
+{
+	this->_setBitmap(bitmap);
+	this->crop(cropRect);
+}
+
 easy2d::Image::~Image()
 {
 }
@@ -180,6 +267,24 @@ bool easy2d::Image::preload(const String& filePath)
 		return true;
 	}
 
+	// ȴѹصԴм
+	Resource::Data data = Package::find(filePath);
+	if (data.isValid())
+	{
+		ID2D1Bitmap *pBitmap = nullptr;
+		if (FAILED(CreateBitmapFromMemory(data.buffer, static_cast<DWORD>(data.size), &pBitmap)))
+		{
+			return false;
+		}
+
+		s_mBitmapsFromFile.insert(
+			std::map<size_t, ID2D1Bitmap*>::value_type(
+				std::hash<String>{}(filePath),
+				pBitmap)
+		);
+		return true;
+	}
+
 	String actualFilePath = Path::searchForFile(filePath);
 	if (actualFilePath.empty())
 	{
@@ -267,13 +372,7 @@ bool easy2d::Image::preload(int resNameId, const String& resType)
 
 	HRESULT hr = S_OK;
 
-	IWICBitmapDecoder *pDecoder = nullptr;
-	IWICBitmapFrameDecode *pSource = nullptr;
-	IWICStream *pStream = nullptr;
-	IWICFormatConverter *pConverter = nullptr;
-	IWICBitmapScaler *pScaler = nullptr;
 	ID2D1Bitmap *pBitmap = nullptr;
-
 	HRSRC imageResHandle = nullptr;
 	HGLOBAL imageResDataHandle = nullptr;
 	void *pImageFile = nullptr;
@@ -309,64 +408,7 @@ bool easy2d::Image::preload(int resNameId, const String& resType)
 
 	if (SUCCEEDED(hr))
 	{
-		//  WIC 
-		hr = Renderer::getIWICImagingFactory()->CreateStream(&pStream);
-	}
-
-	if (SUCCEEDED(hr))
-	{
-		// ʼ
-		hr = pStream->InitializeFromMemory(
-			reinterpret_cast<BYTE*>(pImageFile),
-			imageFileSize
-		);
-	}
-
-	if (SUCCEEDED(hr))
-	{
-		// Ľ
-		hr = Renderer::getIWICImagingFactory()->CreateDecoderFromStream(
-			pStream,
-			nullptr,
-			WICDecodeMetadataCacheOnLoad,
-			&pDecoder
-		);
-	}
-
-	if (SUCCEEDED(hr))
-	{
-		// ʼ
-		hr = pDecoder->GetFrame(0, &pSource);
-	}
-
-	if (SUCCEEDED(hr))
-	{
-		// ͼƬʽת
-		// (DXGI_FORMAT_B8G8R8A8_UNORM + D2D1_ALPHA_MODE_PREMULTIPLIED).
-		hr = Renderer::getIWICImagingFactory()->CreateFormatConverter(&pConverter);
-	}
-
-	if (SUCCEEDED(hr))
-	{
-		// ͼƬʽת 32bppPBGRA
-		hr = pConverter->Initialize(
-			pSource,
-			GUID_WICPixelFormat32bppPBGRA,
-			WICBitmapDitherTypeNone,
-			nullptr,
-			0.f,
-			WICBitmapPaletteTypeMedianCut
-		);
-	}
-
-	if (SUCCEEDED(hr))
-	{
-		//  WIC λͼһ Direct2D λͼ
-		hr = Renderer::getRenderTarget()->CreateBitmapFromWicBitmap(
-			pConverter,
-			nullptr,
-			&pBitmap
-		);
+		hr = CreateBitmapFromMemory(pImageFile, imageFileSize, &pBitmap);
 	}
 
 	if (SUCCEEDED(hr))
@@ -374,13 +416,6 @@ bool easy2d::Image::preload(int resNameId, const String& resType)
 		s_mBitmapsFromResource.insert(std::pair<int, ID2D1Bitmap*>(resNameId, pBitmap));
 	}
 
-	// ͷԴ
-	SafeRelease(pDecoder);
-	SafeRelease(pSource);
-	SafeRelease(pStream);
-	SafeRelease(pConverter);
-	SafeRelease(pScaler);
-
 	return SUCCEEDED(hr);
 }
 
@@ -398,6 +433,20 @@ void easy2d::Image::clearCache()
 		SafeRelease(bitmap.second);
 	}
 	s_mBitmapsFromResource.clear();
+
+	for (auto bitmap : s_vBitmapsFromAtlas)
+	{
+		SafeRelease(bitmap);
+	}
+	s_vBitmapsFromAtlas.clear();
+}
+
+void easy2d::Image::_cacheBitmap(ID2D1Bitmap * bitmap)
+{
+	if (bitmap)
+	{
+		s_vBitmapsFromAtlas.push_back(bitmap);
+	}
 }
 
 void easy2d::Image::_setBitmap(ID2D1Bitmap * bitmap)
@@ -0,0 +1,107 @@
+#include <easy2d/e2dcommon.h>
+
+easy2d::KeySet::KeySet()
+{
+	clear();
+}
+
+easy2d::KeySet::KeySet(std::initializer_list<KeyCode::Value> keys)
+{
+	clear();
+	for (auto key : keys)
+	{
+		add(key);
+	}
+}
+
+easy2d::KeySet& easy2d::KeySet::add(KeyCode::Value key)
+{
+	UINT32 code = static_cast<UINT32>(key);
+	if (code < 256)
+	{
+		_bits[code >> 5] |= (1u << (code & 31));
+	}
+	return *this;
+}
+
+easy2d::KeySet& easy2d::KeySet::remove(KeyCode::Value key)
+{
+	UINT32 code = static_cast<UINT32>(key);
+	if (code < 256)
+	{
+		_bits[code >> 5] &= ~(1u << (code & 31));
+	}
+	return *this;
+}
+
+void easy2d::KeySet::clear()
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		_bits[i] = 0;
+	}
+}
+
+bool easy2d::KeySet::contains(KeyCode::Value key) const
+{
+	UINT32 code = static_cast<UINT32>(key);
+	return code < 256 && (_bits[code >> 5] & (1u << (code & 31))) != 0;
+}
+
+bool easy2d::KeySet::containsAny(const KeySet& other) const
+{
+	UINT32 bits = 0;
+	for (int i = 0; i < 8; ++i)
+	{
+		bits |= _bits[i] & other._bits[i];
+	}
+	return bits != 0;
+}
+
+bool easy2d::KeySet::containsAll(const KeySet& other) const
+{
+	UINT32 bits = 0;
+	for (int i = 0; i < 8; ++i)
+	{
+		bits |= other._bits[i] & ~_bits[i];
+	}
+	return bits == 0;
+}
+
+bool easy2d::KeySet::isEmpty() const
+{
+	UINT32 bits = 0;
+	for (int i = 0; i < 8; ++i)
+	{
+		bits |= _bits[i];
+	}
+	return bits == 0;
+}
+
+int easy2d::KeySet::getCount() const
+{
+	int count = 0;
+	for (int i = 0; i < 8; ++i)
+	{
+		for (UINT32 bits = _bits[i]; bits != 0; bits &= bits - 1)
+		{
+			++count;
+		}
+	}
+	return count;
+}
+
+bool easy2d::KeySet::operator==(const KeySet& other) const
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		if (_bits[i] != other._bits[i])
+			return false;
+	}
+	return true;
+}
+
+bool easy2d::KeySet::operator!=(const KeySet& other) const
+{
+	return !(*this == other);
+}
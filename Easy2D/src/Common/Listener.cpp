@@ -5,14 +5,16 @@ easy2d::Listener::Listener()
 	, _callback()
 	, _running(true)
 	, _done(false)
+	, _eventMask(EventMask::All)
 {
 }
 
-easy2d::Listener::Listener(const Callback& func, const String & name, bool paused)
+easy2d::Listener::Listener(const Callback& func, const String & name, bool paused, UINT eventMask)
 	: _name(name)
 	, _callback(func)
 	, _running(!paused)
 	, _done(false)
+	, _eventMask(eventMask)
 {
 }
 
@@ -44,6 +46,16 @@ void easy2d::Listener::setCallback(const Callback& func)
 	_callback = func;
 }
 
+UINT easy2d::Listener::getEventMask() const
+{
+	return _eventMask;
+}
+
+bool easy2d::Listener::isListening(UINT type) const
+{
+	return (_eventMask & EventMask::of(type)) != 0;
+}
+
 void easy2d::Listener::done()
 {
 	_done = true;
@@ -0,0 +1,104 @@
+#include <easy2d/e2dcommon.h>
+
+easy2d::SkylinePacker::SkylinePacker(int width, int height)
+	: _width(width)
+	, _height(height)
+	, _usedHeight(0)
+{
+	Segment segment = { 0, 0, width };
+	_skyline.push_back(segment);
+}
+
+bool easy2d::SkylinePacker::insert(int width, int height, int & outX, int & outY)
+{
+	int bestIndex = -1;
+	int bestTop = _height + 1;
+	int bestWidth = _width + 1;
+
+	for (size_t i = 0; i < _skyline.size(); ++i)
+	{
+		int y = 0;
+		if (_fit(i, width, height, y))
+		{
+			int top = y + height;
+			if (top < bestTop || (top == bestTop && _skyline[i].width < bestWidth))
+			{
+				bestIndex = static_cast<int>(i);
+				bestTop = top;
+				bestWidth = _skyline[i].width;
+				outX = _skyline[i].x;
+				outY = y;
+			}
+		}
+	}
+
+	if (bestIndex < 0)
+		return false;
+
+	_addSegment(static_cast<size_t>(bestIndex), outX, outY + height, width);
+	_usedHeight = max(_usedHeight, outY + height);
+	return true;
+}
+
+int easy2d::SkylinePacker::getUsedHeight() const
+{
+	return _usedHeight;
+}
+
+bool easy2d::SkylinePacker::_fit(size_t index, int width, int height, int & outY) const
+{
+	int x = _skyline[index].x;
+	if (x + width > _width)
+		return false;
+
+	int remaining = width;
+	int y = _skyline[index].y;
+	while (remaining > 0)
+	{
+		y = max(y, _skyline[index].y);
+		if (y + height > _height)
+			return false;
+
+		remaining -= _skyline[index].width;
+		++index;
+	}
+	outY = y;
+	return true;
+}
+
+void easy2d::SkylinePacker::_addSegment(size_t index, int x, int y, int width)
+{
+	Segment segment = { x, y, width };
+	_skyline.insert(_skyline.begin() + index, segment);
+
+	// õ¶θǵĲ
+	for (size_t i = index + 1; i < _skyline.size(); )
+	{
+		Segment& prev = _skyline[i - 1];
+		Segment& curr = _skyline[i];
+		int shrink = prev.x + prev.width - curr.x;
+		if (shrink <= 0)
+			break;
+
+		curr.x += shrink;
+		curr.width -= shrink;
+		if (curr.width > 0)
+			break;
+
+		_skyline.erase(_skyline.begin() + i);
+	}
+
+	// ϲ߶ͬڶ
+	for (size_t i = 0; i + 1 < _skyline.size(); )
+	{
+		if (_skyline[i].y == _skyline[i + 1].y)
+		{
+			_skyline[i].width += _skyline[i + 1].width;
+			_skyline.erase(_skyline.begin() + i + 1);
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
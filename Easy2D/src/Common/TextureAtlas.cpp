@@ -0,0 +1,370 @@
+#include <easy2d/e2dcommon.h>
+#include <easy2d/e2dbase.h>
+#include <easy2d/e2dtool.h>
+#include <algorithm>
+#include <chrono>
+using namespace std::chrono;
+
+namespace
+{
+	// ͼƬļΪ 32bppPBGRA 
+	bool DecodeImageFile(const easy2d::String& filePath, UINT& width, UINT& height, std::vector<BYTE>& pixels)
+	{
+		HRESULT hr = S_OK;
+
+		IWICBitmapDecoder *pDecoder = nullptr;
+		IWICBitmapFrameDecode *pSource = nullptr;
+		IWICFormatConverter *pConverter = nullptr;
+
+		// 
+		hr = easy2d::Renderer::getIWICImagingFactory()->CreateDecoderFromFilename(
+			filePath.c_str(),
+			nullptr,
+			GENERIC_READ,
+			WICDecodeMetadataCacheOnLoad,
+			&pDecoder
+		);
+
+		if (SUCCEEDED(hr))
+		{
+			hr = pDecoder->GetFrame(0, &pSource);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			hr = easy2d::Renderer::getIWICImagingFactory()->CreateFormatConverter(&pConverter);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			hr = pConverter->Initialize(
+				pSource,
+				GUID_WICPixelFormat32bppPBGRA,
+				WICBitmapDitherTypeNone,
+				nullptr,
+				0.f,
+				WICBitmapPaletteTypeMedianCut
+			);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			hr = pConverter->GetSize(&width, &height);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			pixels.resize(static_cast<size_t>(width) * height * 4);
+			hr = pConverter->CopyPixels(
+				nullptr,
+				width * 4,
+				static_cast<UINT>(pixels.size()),
+				pixels.data()
+			);
+		}
+
+		SafeRelease(pDecoder);
+		SafeRelease(pSource);
+		SafeRelease(pConverter);
+
+		return SUCCEEDED(hr);
+	}
+
+	// жǷΪ WIC ֵ֧ĳͼƬʽ
+	bool IsImageFile(const easy2d::String& fileName)
+	{
+		static const wchar_t* extensions[] = { L".png", L".jpg", L".jpeg", L".bmp", L".gif", L".tif", L".tiff" };
+
+		size_t dot = fileName.find_last_of(L'.');
+		if (dot == easy2d::String::npos)
+			return false;
+
+		easy2d::String ext = fileName.substr(dot);
+		std::transform(ext.begin(), ext.end(), ext.begin(), ::towlower);
+
+		for (auto e : extensions)
+		{
+			if (ext == e)
+				return true;
+		}
+		return false;
+	}
+}
+
+
+easy2d::TextureAtlas::TextureAtlas(int pageWidth, int pageHeight, int padding)
+	: _pageWidth(max(pageWidth, 1))
+	, _pageHeight(max(pageHeight, 1))
+	, _padding(max(padding, 0))
+	, _packed(false)
+{
+	ZeroMemory(&_stats, sizeof(Stats));
+}
+
+easy2d::TextureAtlas::~TextureAtlas()
+{
+	// ͼλͼ Image Ļ
+}
+
+bool easy2d::TextureAtlas::add(const String& filePath)
+{
+	if (_packed)
+	{
+		E2D_WARNING(L"Can not add image to a packed TextureAtlas");
+		return false;
+	}
+
+	size_t hash = std::hash<String>{}(filePath);
+	for (const auto& entry : _entries)
+	{
+		if (entry.hash == hash && entry.name == filePath)
+			return true;
+	}
+
+	String actualFilePath = Path::searchForFile(filePath);
+	if (actualFilePath.empty())
+	{
+		E2D_WARNING(L"TextureAtlas add failed! File not found.");
+		return false;
+	}
+
+	auto start = steady_clock::now();
+
+	Entry entry;
+	entry.hash = hash;
+	entry.name = filePath;
+	entry.page = -1;
+	entry.x = entry.y = 0;
+	if (!DecodeImageFile(actualFilePath, entry.width, entry.height, entry.pixels))
+	{
+		E2D_WARNING(L"TextureAtlas add failed! Decode image failed.");
+		return false;
+	}
+
+	if (static_cast<int>(entry.width) + _padding > _pageWidth ||
+		static_cast<int>(entry.height) + _padding > _pageHeight)
+	{
+		E2D_WARNING(L"TextureAtlas add failed! Image is larger than the atlas page.");
+		return false;
+	}
+
+	_entries.push_back(std::move(entry));
+	_stats.loadTime += duration_cast<microseconds>(steady_clock::now() - start).count() / 1000.f;
+	return true;
+}
+
+int easy2d::TextureAtlas::addFolder(const String& dirPath)
+{
+	String folder = dirPath;
+	if (!folder.empty() && folder.back() != L'\\' && folder.back() != L'/')
+	{
+		folder.push_back(L'\\');
+	}
+
+	String actualFolder = Path::searchForFile(folder);
+	if (actualFolder.empty())
+	{
+		E2D_WARNING(L"TextureAtlas addFolder failed! Folder not found.");
+		return 0;
+	}
+
+	WIN32_FIND_DATAW findData;
+	HANDLE hFind = ::FindFirstFileW((actualFolder + L"*").c_str(), &findData);
+	if (hFind == INVALID_HANDLE_VALUE)
+		return 0;
+
+	int count = 0;
+	do
+	{
+		if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && IsImageFile(findData.cFileName))
+		{
+			if (this->add(folder + findData.cFileName))
+			{
+				++count;
+			}
+		}
+	} while (::FindNextFileW(hFind, &findData));
+
+	::FindClose(hFind);
+	return count;
+}
+
+bool easy2d::TextureAtlas::pack()
+{
+	if (_packed)
+		return true;
+
+	if (_entries.empty())
+		return false;
+
+	auto start = steady_clock::now();
+
+	std::vector<Placement> rects(_entries.size());
+	for (size_t i = 0; i < _entries.size(); ++i)
+	{
+		rects[i].width = static_cast<int>(_entries[i].width);
+		rects[i].height = static_cast<int>(_entries[i].height);
+	}
+
+	std::vector<int> pageHeights;
+	if (!TextureAtlas::layout(rects, pageHeights, _pageWidth, _pageHeight, _padding))
+	{
+		E2D_WARNING(L"TextureAtlas pack failed! Image is larger than the atlas page.");
+		return false;
+	}
+
+	for (size_t i = 0; i < _entries.size(); ++i)
+	{
+		_entries[i].page = rects[i].page;
+		_entries[i].x = static_cast<UINT>(rects[i].x);
+		_entries[i].y = static_cast<UINT>(rects[i].y);
+	}
+
+	// ÿһҳֻʵõĸ߶
+	double usedArea = 0;
+	double totalArea = 0;
+	bool succeeded = true;
+
+	for (size_t page = 0; page < pageHeights.size(); ++page)
+	{
+		UINT pageHeight = static_cast<UINT>(pageHeights[page]);
+		UINT pitch = static_cast<UINT>(_pageWidth) * 4;
+		std::vector<BYTE> pixels(static_cast<size_t>(pitch) * pageHeight, 0);
+
+		for (const auto& entry : _entries)
+		{
+			if (entry.page != static_cast<int>(page))
+				continue;
+
+			UINT rowSize = entry.width * 4;
+			for (UINT row = 0; row < entry.height; ++row)
+			{
+				memcpy(
+					&pixels[(entry.y + row) * pitch + entry.x * 4],
+					&entry.pixels[row * rowSize],
+					rowSize
+				);
+			}
+			usedArea += static_cast<double>(entry.width) * entry.height;
+		}
+		totalArea += static_cast<double>(_pageWidth) * pageHeight;
+
+		ID2D1Bitmap * bitmap = nullptr;
+		HRESULT hr = Renderer::getRenderTarget()->CreateBitmap(
+			D2D1::SizeU(static_cast<UINT>(_pageWidth), pageHeight),
+			pixels.data(),
+			pitch,
+			D2D1::BitmapProperties(D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED)),
+			&bitmap
+		);
+
+		if (FAILED(hr))
+		{
+			E2D_WARNING(L"TextureAtlas pack failed! Create bitmap failed.");
+			succeeded = false;
+			bitmap = nullptr;
+		}
+
+		Image::_cacheBitmap(bitmap);
+		_pages.push_back(bitmap);
+	}
+
+	// ϴͼͷŽݣƵĹϣֵԱ
+	for (auto& entry : _entries)
+	{
+		std::vector<BYTE>().swap(entry.pixels);
+	}
+	std::sort(_entries.begin(), _entries.end(), [](const Entry& a, const Entry& b) { return a.hash < b.hash; });
+
+	_packed = true;
+	_stats.pageCount = static_cast<int>(_pages.size());
+	_stats.imageCount = static_cast<int>(_entries.size());
+	_stats.efficiency = totalArea > 0 ? static_cast<float>(usedArea / totalArea) : 0.f;
+	_stats.packTime = duration_cast<microseconds>(steady_clock::now() - start).count() / 1000.f;
+	return succeeded;
+}
+
+easy2d::Image * easy2d::TextureAtlas::getImage(const String& filePath) const
+{
+	if (!_packed)
+	{
+		E2D_WARNING(L"TextureAtlas is not packed yet");
+		return nullptr;
+	}
+
+	// ϣֵͬƿֹܲһҪٱȽ
+	size_t hash = std::hash<String>{}(filePath);
+	auto iter = std::lower_bound(_entries.begin(), _entries.end(), hash, [](const Entry& entry, size_t h) { return entry.hash < h; });
+	while (iter != _entries.end() && iter->hash == hash && iter->name != filePath)
+	{
+		++iter;
+	}
+
+	if (iter == _entries.end() || iter->hash != hash || !_pages[iter->page])
+		return nullptr;
+
+	return gcnew Image(
+		_pages[iter->page],
+		Rect(static_cast<float>(iter->x), static_cast<float>(iter->y), static_cast<float>(iter->width), static_cast<float>(iter->height))
+	);
+}
+
+const easy2d::TextureAtlas::Stats & easy2d::TextureAtlas::getStats() const
+{
+	return _stats;
+}
+
+bool easy2d::TextureAtlas::layout(std::vector<Placement>& rects, std::vector<int>& pageHeights, int pageWidth, int pageHeight, int padding)
+{
+	pageHeights.clear();
+
+	// ߶ȴӴСŲԼϵĿ϶
+	std::vector<size_t> order(rects.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		order[i] = i;
+		rects[i].page = -1;
+		rects[i].x = rects[i].y = 0;
+	}
+	std::sort(order.begin(), order.end(), [&rects](size_t a, size_t b)
+	{
+		const Placement& ra = rects[a];
+		const Placement& rb = rects[b];
+		return ra.height != rb.height ? ra.height > rb.height : ra.width > rb.width;
+	});
+
+	std::vector<SkylinePacker> packers;
+	for (auto index : order)
+	{
+		Placement& rect = rects[index];
+		int w = rect.width + padding;
+		int h = rect.height + padding;
+		int x = 0, y = 0;
+
+		for (size_t page = 0; page < packers.size(); ++page)
+		{
+			if (packers[page].insert(w, h, x, y))
+			{
+				rect.page = static_cast<int>(page);
+				break;
+			}
+		}
+
+		if (rect.page < 0)
+		{
+			packers.push_back(SkylinePacker(pageWidth, pageHeight));
+			if (!packers.back().insert(w, h, x, y))
+				return false;
+			rect.page = static_cast<int>(packers.size() - 1);
+		}
+
+		rect.x = x;
+		rect.y = y;
+	}
+
+	for (const auto& packer : packers)
+	{
+		pageHeights.push_back(packer.getUsedHeight());
+	}
+	return true;
+}
@@ -5,7 +5,7 @@
 static std::vector<easy2d::Action*> s_vActions;
 
 
-void easy2d::ActionManager::__update()
+void easy2d::ActionManager::__update(float dt)
 {
 	if (s_vActions.empty() || Game::isPaused())
 		return;
@@ -23,10 +23,11 @@ void easy2d::ActionManager::__update()
 		}
 		else
 		{
-			if (action->isRunning())
+			// ѽɲµĶٵִ
+			if (action->isRunning() && !action->_tweening)
 			{
-				// ִж
-				action->_update();
+				// ִжڵʱűƽ
+				action->_update(dt * action->_target->getTimeScale());
 			}
 		}
 	}
@@ -145,6 +146,8 @@ void easy2d::ActionManager::__clearAllBindedWith(Node * target)
 {
 	if (target)
 	{
+		TweenManager::__clearAllBindedWith(target);
+
 		for (size_t i = 0; i < s_vActions.size();)
 		{
 			auto a = s_vActions[i];
@@ -163,6 +166,8 @@ void easy2d::ActionManager::__clearAllBindedWith(Node * target)
 
 void easy2d::ActionManager::__uninit()
 {
+	TweenManager::__uninit();
+
 	for (auto action : s_vActions)
 	{
 		GC::release(action);
@@ -0,0 +1,205 @@
+#include <easy2d/e2dmanager.h>
+#include <easy2d/e2dbase.h>
+
+namespace
+{
+	// Ŷе¼ͳһʹһֽյļ¼
+	struct EventRecord
+	{
+		UINT type;
+		float x;
+		float y;
+		float delta;
+		int code;
+		int count;
+	};
+
+	bool s_bCoalescing = true;
+	bool s_bDispatching = false;
+	easy2d::EventQueue::Stats s_Stats = { 0, 0, 0 };
+	std::vector<EventRecord> s_vEvents;
+	// ַʱ s_vEvents ʹ黺Էʹ
+	std::vector<EventRecord> s_vDispatching;
+
+	void Push(UINT type, float x, float y, float delta, int code, int count)
+	{
+		++s_Stats.received;
+
+		// ֻβ¼ϲ֤밴¼֮Ⱥ˳򲻱
+		if (s_bCoalescing && !s_vEvents.empty() && s_vEvents.back().type == type)
+		{
+			EventRecord& last = s_vEvents.back();
+			if (type == easy2d::Event::MouseMove)
+			{
+				last.x = x;
+				last.y = y;
+				++s_Stats.coalesced;
+				return;
+			}
+			else if (type == easy2d::Event::MouseWheel)
+			{
+				last.x = x;
+				last.y = y;
+				last.delta += delta;
+				++s_Stats.coalesced;
+				return;
+			}
+		}
+
+		EventRecord record = { type, x, y, delta, code, count };
+		s_vEvents.push_back(record);
+	}
+
+	void Dispatch(const EventRecord& record)
+	{
+		using namespace easy2d;
+
+		switch (record.type)
+		{
+		case Event::MouseMove:
+		{
+			MouseMoveEvent evt(record.x, record.y);
+			SceneManager::dispatch(&evt);
+		}
+		break;
+
+		case Event::MouseDown:
+		{
+			MouseDownEvent evt(record.x, record.y, MouseCode::Value(record.code));
+			SceneManager::dispatch(&evt);
+		}
+		break;
+
+		case Event::MouseUp:
+		{
+			MouseUpEvent evt(record.x, record.y, MouseCode::Value(record.code));
+			SceneManager::dispatch(&evt);
+		}
+		break;
+
+		case Event::MouseWheel:
+		{
+			MouseWheelEvent evt(record.x, record.y, record.delta);
+			SceneManager::dispatch(&evt);
+		}
+		break;
+
+		case Event::KeyDown:
+		{
+			KeyDownEvent evt(KeyCode::Value(record.code), record.count);
+			SceneManager::dispatch(&evt);
+		}
+		break;
+
+		case Event::KeyUp:
+		{
+			KeyUpEvent evt(KeyCode::Value(record.code), record.count);
+			SceneManager::dispatch(&evt);
+		}
+		break;
+
+		default:
+			return;
+		}
+
+		++s_Stats.dispatched;
+	}
+}
+
+void easy2d::EventQueue::pushMouseMove(float x, float y)
+{
+	__push(Event::MouseMove, x, y, 0, 0, 0);
+}
+
+void easy2d::EventQueue::pushMouseDown(float x, float y, MouseCode::Value btn)
+{
+	__push(Event::MouseDown, x, y, 0, int(btn), 0);
+}
+
+void easy2d::EventQueue::pushMouseUp(float x, float y, MouseCode::Value btn)
+{
+	__push(Event::MouseUp, x, y, 0, int(btn), 0);
+}
+
+void easy2d::EventQueue::pushMouseWheel(float x, float y, float delta)
+{
+	__push(Event::MouseWheel, x, y, delta, 0, 0);
+}
+
+void easy2d::EventQueue::pushKeyDown(KeyCode::Value key, int count)
+{
+	__push(Event::KeyDown, 0, 0, 0, int(key), count);
+}
+
+void easy2d::EventQueue::pushKeyUp(KeyCode::Value key, int count)
+{
+	__push(Event::KeyUp, 0, 0, 0, int(key), count);
+}
+
+void easy2d::EventQueue::__push(UINT type, float x, float y, float delta, int code, int count)
+{
+	// طʱ¼洰
+	if (InputRecorder::isReplaying())
+		return;
+
+	if (InputRecorder::isRecording())
+	{
+		InputRecorder::__recordEvent(type, x, y, delta, code, count);
+	}
+	Push(type, x, y, delta, code, count);
+}
+
+void easy2d::EventQueue::__pushReplayed(UINT type, float x, float y, float delta, int code, int count)
+{
+	Push(type, x, y, delta, code, count);
+}
+
+void easy2d::EventQueue::flush()
+{
+	// ٴε flush ʱֱӷ
+	if (s_bDispatching || s_vEvents.empty())
+		return;
+
+	// ַ²¼һηַ
+	s_bDispatching = true;
+	s_vDispatching.swap(s_vEvents);
+	for (size_t i = 0; i < s_vDispatching.size(); ++i)
+	{
+		Dispatch(s_vDispatching[i]);
+	}
+	s_vDispatching.clear();
+	s_bDispatching = false;
+}
+
+size_t easy2d::EventQueue::getPendingCount()
+{
+	return s_vEvents.size();
+}
+
+void easy2d::EventQueue::setCoalescing(bool enabled)
+{
+	s_bCoalescing = enabled;
+}
+
+easy2d::EventQueue::Stats easy2d::EventQueue::getStats()
+{
+	return s_Stats;
+}
+
+void easy2d::EventQueue::resetStats()
+{
+	s_Stats.received = 0;
+	s_Stats.dispatched = 0;
+	s_Stats.coalesced = 0;
+}
+
+void easy2d::EventQueue::__dispatch()
+{
+	EventQueue::flush();
+}
+
+void easy2d::EventQueue::__uninit()
+{
+	s_vEvents.clear();
+	s_vDispatching.clear();
+}
@@ -0,0 +1,516 @@
+#include <easy2d/e2dmanager.h>
+#include <easy2d/e2daction.h>
+#include <easy2d/e2dnode.h>
+
+namespace
+{
+	// 
+	const int TWEEN_PROPERTY_COUNT = static_cast<int>(easy2d::TweenManager::Property::Opacity) + 1;
+
+	// ͬһԵв䣬ÿֶε洢
+	// ʹȼڽյѭ
+	class TweenList
+	{
+	public:
+		size_t size() const
+		{
+			return owners.size();
+		}
+
+		void push(
+			easy2d::FiniteTimeAction * owner,
+			easy2d::Node * target,
+			float sx, float sy,
+			float dx, float dy,
+			float px, float py,
+			float h, int n,
+			float dur, float elap,
+			easy2d::Ease::Type ease,
+			float r
+		)
+		{
+			owners.push_back(owner);
+			targets.push_back(target);
+			startX.push_back(sx);
+			startY.push_back(sy);
+			deltaX.push_back(dx);
+			deltaY.push_back(dy);
+			prevX.push_back(px);
+			prevY.push_back(py);
+			height.push_back(h);
+			jumps.push_back(n);
+			invDuration.push_back(1.f / dur);
+			elapsed.push_back(elap);
+			rate.push_back(r);
+			progress.push_back(elap / dur);
+			eases.push_back(ease);
+			values.push_back(easy2d::Ease::apply(ease, elap / dur));
+
+			if (ease != easy2d::Ease::Type::Linear)
+			{
+				++easedCount;
+			}
+		}
+
+		// ݽȺͻ㵱ǰֵ
+		// values ֻзԲʱÿ֡ˢ£˲ֱӶȡ
+		float valueAt(size_t i) const
+		{
+			return progress[i] >= 1 ? 1.f : easy2d::Ease::apply(eases[i], progress[i]);
+		}
+
+		// ĩβԪλرƶλõĶ
+		easy2d::FiniteTimeAction * remove(size_t i)
+		{
+			easy2d::FiniteTimeAction * moved = nullptr;
+			size_t last = size() - 1;
+
+			if (eases[i] != easy2d::Ease::Type::Linear)
+			{
+				--easedCount;
+			}
+
+			if (i != last)
+			{
+				owners[i] = owners[last];
+				targets[i] = targets[last];
+				startX[i] = startX[last];
+				startY[i] = startY[last];
+				deltaX[i] = deltaX[last];
+				deltaY[i] = deltaY[last];
+				prevX[i] = prevX[last];
+				prevY[i] = prevY[last];
+				height[i] = height[last];
+				jumps[i] = jumps[last];
+				invDuration[i] = invDuration[last];
+				elapsed[i] = elapsed[last];
+				rate[i] = rate[last];
+				progress[i] = progress[last];
+				eases[i] = eases[last];
+				values[i] = values[last];
+				moved = owners[i];
+			}
+
+			owners.pop_back();
+			targets.pop_back();
+			startX.pop_back();
+			startY.pop_back();
+			deltaX.pop_back();
+			deltaY.pop_back();
+			prevX.pop_back();
+			prevY.pop_back();
+			height.pop_back();
+			jumps.pop_back();
+			invDuration.pop_back();
+			elapsed.pop_back();
+			rate.pop_back();
+			progress.pop_back();
+			eases.pop_back();
+			values.pop_back();
+			return moved;
+		}
+
+		void clear()
+		{
+			owners.clear();
+			targets.clear();
+			startX.clear();
+			startY.clear();
+			deltaX.clear();
+			deltaY.clear();
+			prevX.clear();
+			prevY.clear();
+			height.clear();
+			jumps.clear();
+			invDuration.clear();
+			elapsed.clear();
+			rate.clear();
+			progress.clear();
+			eases.clear();
+			values.clear();
+			easedCount = 0;
+		}
+
+	public:
+		std::vector<easy2d::FiniteTimeAction*> owners;
+		std::vector<easy2d::Node*> targets;
+		std::vector<float> startX;
+		std::vector<float> startY;
+		std::vector<float> deltaX;
+		std::vector<float> deltaY;
+		std::vector<float> prevX;
+		std::vector<float> prevY;
+		std::vector<float> height;
+		std::vector<int> jumps;
+		std::vector<float> invDuration;
+		std::vector<float> elapsed;
+		std::vector<float> rate;
+		std::vector<float> progress;
+		std::vector<easy2d::Ease::Type> eases;
+		std::vector<float> values;
+		size_t easedCount = 0;
+	};
+
+	TweenList s_Tweens[TWEEN_PROPERTY_COUNT];
+
+
+	// ƽвĽ
+	void AdvanceProgress(TweenList& list, float dt)
+	{
+		const size_t size = list.size();
+		float* elapsed = list.elapsed.data();
+		float* progress = list.progress.data();
+		const float* rate = list.rate.data();
+		const float* invDuration = list.invDuration.data();
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			elapsed[i] += dt * rate[i];
+			progress[i] = min(elapsed[i] * invDuration[i], 1.f);
+		}
+	}
+
+	// һλͬĲ䣬ڱȷѭ
+	template <easy2d::Ease::Type T>
+	void EaseRange(const float* progress, float* values, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			values[i] = progress[i] >= 1 ? 1.f : easy2d::Ease::apply<T>(progress[i]);
+		}
+	}
+
+	using EaseRangeFunc = void(*)(const float*, float*, size_t, size_t);
+
+	// 
+	const EaseRangeFunc EASE_RANGE_FUNCS[] =
+	{
+		&EaseRange<easy2d::Ease::Type::Linear>,
+		&EaseRange<easy2d::Ease::Type::QuadIn>,
+		&EaseRange<easy2d::Ease::Type::QuadOut>,
+		&EaseRange<easy2d::Ease::Type::QuadInOut>,
+		&EaseRange<easy2d::Ease::Type::CubicIn>,
+		&EaseRange<easy2d::Ease::Type::CubicOut>,
+		&EaseRange<easy2d::Ease::Type::CubicInOut>,
+		&EaseRange<easy2d::Ease::Type::SineIn>,
+		&EaseRange<easy2d::Ease::Type::SineOut>,
+		&EaseRange<easy2d::Ease::Type::SineInOut>,
+		&EaseRange<easy2d::Ease::Type::BackIn>,
+		&EaseRange<easy2d::Ease::Type::BackOut>,
+		&EaseRange<easy2d::Ease::Type::BackInOut>,
+		&EaseRange<easy2d::Ease::Type::ElasticIn>,
+		&EaseRange<easy2d::Ease::Type::ElasticOut>,
+		&EaseRange<easy2d::Ease::Type::ElasticInOut>,
+		&EaseRange<easy2d::Ease::Type::BounceIn>,
+		&EaseRange<easy2d::Ease::Type::BounceOut>,
+		&EaseRange<easy2d::Ease::Type::BounceInOut>,
+		&EaseRange<easy2d::Ease::Type::Custom>,
+	};
+
+	static_assert(
+		sizeof(EASE_RANGE_FUNCS) / sizeof(EASE_RANGE_FUNCS[0]) == static_cast<size_t>(easy2d::Ease::Type::Custom) + 1,
+		"EASE_RANGE_FUNCS must cover every Ease::Type"
+	);
+
+	// 㻺ĽȣȫΪʱֱʹʱ
+	// ͬһӵĲͨʹͬĻͬɣÿֻѡһλ
+	const float* ApplyEase(TweenList& list)
+	{
+		if (list.easedCount == 0)
+			return list.progress.data();
+
+		const size_t size = list.size();
+		float* values = list.values.data();
+		const float* progress = list.progress.data();
+		const easy2d::Ease::Type* eases = list.eases.data();
+
+		size_t begin = 0;
+		while (begin < size)
+		{
+			easy2d::Ease::Type type = eases[begin];
+			size_t end = begin + 1;
+			while (end < size && eases[end] == type)
+			{
+				++end;
+			}
+
+			EASE_RANGE_FUNCS[static_cast<int>(type)](progress, values, begin, end);
+			begin = end;
+		}
+		return values;
+	}
+
+	// Ծֱƫ
+	inline float JumpOffset(float height, int jumps, float t)
+	{
+		float frac = std::fmodf(t * jumps, 1.0f);
+		return height * 4 * frac * (1 - frac);
+	}
+
+	// 겹䣬Ҫڵڲⷢλ
+	void ApplyPosition(TweenList& list, const float* values, bool jump)
+	{
+		const size_t size = list.size();
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (list.rate[i] == 0)
+				continue;
+
+			easy2d::Node* target = list.targets[i];
+			const float t = values[i];
+
+			list.startX[i] += target->getPosX() - list.prevX[i];
+			list.startY[i] += target->getPosY() - list.prevY[i];
+
+			float x = list.startX[i] + list.deltaX[i] * t;
+			float y = list.startY[i] + list.deltaY[i] * t;
+			if (jump)
+			{
+				y += JumpOffset(list.height[i], list.jumps[i], t);
+			}
+
+			target->setPos(x, y);
+			list.prevX[i] = x;
+			list.prevY[i] = y;
+		}
+	}
+
+	void ApplyScale(TweenList& list, const float* values)
+	{
+		const size_t size = list.size();
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (list.rate[i] == 0)
+				continue;
+
+			const float t = values[i];
+			list.targets[i]->setScale(
+				list.startX[i] + list.deltaX[i] * t,
+				list.startY[i] + list.deltaY[i] * t
+			);
+		}
+	}
+
+	void ApplyRotation(TweenList& list, const float* values)
+	{
+		const size_t size = list.size();
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (list.rate[i] == 0)
+				continue;
+
+			list.targets[i]->setRotation(list.startX[i] + list.deltaX[i] * values[i]);
+		}
+	}
+
+	void ApplyOpacity(TweenList& list, const float* values)
+	{
+		const size_t size = list.size();
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (list.rate[i] == 0)
+				continue;
+
+			list.targets[i]->setOpacity(list.startX[i] + list.deltaX[i] * values[i]);
+		}
+	}
+}
+
+
+size_t easy2d::TweenManager::getCount()
+{
+	size_t count = 0;
+	for (const auto& list : s_Tweens)
+	{
+		count += list.size();
+	}
+	return count;
+}
+
+size_t easy2d::TweenManager::getCount(Property prop)
+{
+	return s_Tweens[static_cast<int>(prop)].size();
+}
+
+bool easy2d::TweenManager::__add(FiniteTimeAction * action, Property prop, float startX, float startY, float deltaX, float deltaY, float height, int jumps)
+{
+	if (action == nullptr || action->_target == nullptr || action->_tweening || action->_duration <= 0)
+		return false;
+
+	// Զ建޷㣬ɶ
+	if (action->_easeFunc)
+		return false;
+
+	float elapsed = action->_progress * action->_duration;
+
+	// ¼ڱ֡õֵڼ㲹λ
+	float prevX = startX + deltaX * action->_delta;
+	float prevY = startY + deltaY * action->_delta;
+	if (prop == Property::Jump)
+	{
+		prevY += JumpOffset(height, jumps, action->_delta);
+	}
+
+	auto& list = s_Tweens[static_cast<int>(prop)];
+	list.push(
+		action,
+		action->_target,
+		startX, startY,
+		deltaX, deltaY,
+		prevX, prevY,
+		height, jumps,
+		action->_duration,
+		elapsed,
+		action->_easeType,
+		action->_running ? action->_target->getTimeScale() : 0.f
+	);
+
+	action->_tweening = true;
+	action->_tweenIndex = static_cast<int>(list.size() - 1);
+	action->_tweenProperty = prop;
+	return true;
+}
+
+void easy2d::TweenManager::__remove(FiniteTimeAction * action)
+{
+	if (action == nullptr || !action->_tweening)
+		return;
+
+	auto& list = s_Tweens[static_cast<int>(action->_tweenProperty)];
+	size_t index = static_cast<size_t>(action->_tweenIndex);
+
+	// ͬ
+	action->_progress = list.progress[index];
+	action->_delta = list.valueAt(index);
+	action->_tweening = false;
+	action->_tweenIndex = -1;
+
+	auto moved = list.remove(index);
+	if (moved)
+	{
+		moved->_tweenIndex = static_cast<int>(index);
+	}
+}
+
+void easy2d::TweenManager::__setPaused(FiniteTimeAction * action, bool paused)
+{
+	if (action == nullptr || !action->_tweening)
+		return;
+
+	auto& list = s_Tweens[static_cast<int>(action->_tweenProperty)];
+	list.rate[action->_tweenIndex] = paused ? 0.f : action->_target->getTimeScale();
+}
+
+void easy2d::TweenManager::__updateTimeScale(Node * target)
+{
+	if (target == nullptr)
+		return;
+
+	for (auto& list : s_Tweens)
+	{
+		const size_t size = list.size();
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (list.targets[i] == target)
+			{
+				list.rate[i] = list.owners[i]->_running ? target->getTimeScale() : 0.f;
+			}
+		}
+	}
+}
+
+void easy2d::TweenManager::__update(float dt)
+{
+	if (Game::isPaused())
+		return;
+
+	for (int i = 0; i < TWEEN_PROPERTY_COUNT; ++i)
+	{
+		auto& list = s_Tweens[i];
+		if (list.size() == 0)
+			continue;
+
+		AdvanceProgress(list, dt);
+		const float* values = ApplyEase(list);
+
+		switch (static_cast<Property>(i))
+		{
+		case Property::Position:
+			ApplyPosition(list, values, false);
+			break;
+		case Property::Jump:
+			ApplyPosition(list, values, true);
+			break;
+		case Property::Scale:
+			ApplyScale(list, values);
+			break;
+		case Property::Rotation:
+			ApplyRotation(list, values);
+			break;
+		case Property::Opacity:
+			ApplyOpacity(list, values);
+			break;
+		}
+
+		// ƳɵĲ䣬֤λԪѱ
+		for (size_t j = list.size(); j > 0; --j)
+		{
+			size_t index = j - 1;
+			if (list.progress[index] >= 1)
+			{
+				auto owner = list.owners[index];
+				owner->_delta = 1;
+				owner->_progress = 1;
+				owner->_done = true;
+				owner->_tweening = false;
+				owner->_tweenable = false;
+				owner->_tweenIndex = -1;
+
+				auto moved = list.remove(index);
+				if (moved)
+				{
+					moved->_tweenIndex = static_cast<int>(index);
+				}
+			}
+		}
+	}
+}
+
+void easy2d::TweenManager::__clearAllBindedWith(Node * target)
+{
+	if (target == nullptr)
+		return;
+
+	for (auto& list : s_Tweens)
+	{
+		for (size_t j = list.size(); j > 0; --j)
+		{
+			size_t index = j - 1;
+			if (list.targets[index] == target)
+			{
+				auto owner = list.owners[index];
+				owner->_tweening = false;
+				owner->_tweenIndex = -1;
+
+				auto moved = list.remove(index);
+				if (moved)
+				{
+					moved->_tweenIndex = static_cast<int>(index);
+				}
+			}
+		}
+	}
+}
+
+void easy2d::TweenManager::__uninit()
+{
+	for (auto& list : s_Tweens)
+	{
+		for (auto owner : list.owners)
+		{
+			owner->_tweening = false;
+			owner->_tweenIndex = -1;
+		}
+		list.clear();
+	}
+}
@@ -0,0 +1,140 @@
+#include <easy2d/e2dnode.h>
+
+easy2d::BitmapText::BitmapText()
+	: _alignment(Text::Align::Left)
+	, _font(nullptr)
+{
+}
+
+easy2d::BitmapText::BitmapText(BitmapFont * font, const String & text)
+	: _text(text)
+	, _alignment(Text::Align::Left)
+	, _font(nullptr)
+{
+	this->setFont(font);
+}
+
+easy2d::BitmapText::BitmapText(const String & fontFilePath, const String & text)
+	: _text(text)
+	, _alignment(Text::Align::Left)
+	, _font(nullptr)
+{
+	this->setFont(gcnew BitmapFont(fontFilePath));
+}
+
+easy2d::BitmapText::~BitmapText()
+{
+	GC::release(_font);
+}
+
+easy2d::String easy2d::BitmapText::getText() const
+{
+	return _text;
+}
+
+easy2d::BitmapFont * easy2d::BitmapText::getFont() const
+{
+	return _font;
+}
+
+easy2d::Text::Align easy2d::BitmapText::getAlignment() const
+{
+	return _alignment;
+}
+
+void easy2d::BitmapText::setText(const String & text)
+{
+	// ÿ֡ͬķʱŰ
+	if (_text != text)
+	{
+		_text = text;
+		_invalidateLayout();
+	}
+}
+
+void easy2d::BitmapText::setFont(BitmapFont * font)
+{
+	if (font != _font)
+	{
+		GC::release(_font);
+		_font = font;
+		if (_font)
+			_font->retain();
+		_invalidateLayout();
+	}
+}
+
+void easy2d::BitmapText::setAlignment(Text::Align align)
+{
+	if (_alignment != align)
+	{
+		_alignment = align;
+		_invalidateLayout();
+	}
+}
+
+void easy2d::BitmapText::onRender()
+{
+	if (!_font || _quads.empty())
+		return;
+
+	auto renderTarget = Renderer::getRenderTarget();
+
+	// ڵͨͬһҳУֻҳ仯ʱ»ȡλͼ
+	int currentPage = -1;
+	ID2D1Bitmap * bitmap = nullptr;
+	Point cropPos;
+
+	for (const auto& quad : _quads)
+	{
+		if (quad.page != currentPage)
+		{
+			currentPage = quad.page;
+			Image * page = _font->getPage(currentPage);
+			bitmap = page ? page->getBitmap() : nullptr;
+			cropPos = page ? page->getCropPos() : Point();
+		}
+
+		if (!bitmap)
+			continue;
+
+		renderTarget->DrawBitmap(
+			bitmap,
+			D2D1::RectF(quad.dest.getLeft(), quad.dest.getTop(), quad.dest.getRight(), quad.dest.getBottom()),
+			_displayOpacity,
+			D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
+			D2D1::RectF(
+				cropPos.x + quad.src.getLeft(),
+				cropPos.y + quad.src.getTop(),
+				cropPos.x + quad.src.getRight(),
+				cropPos.y + quad.src.getBottom()
+			)
+		);
+	}
+}
+
+void easy2d::BitmapText::_rebuildLayout()
+{
+	if (!_font || _text.empty())
+	{
+		_quads.clear();
+		this->setSize(0, 0);
+		return;
+	}
+
+	float alignment = 0;
+	switch (_alignment)
+	{
+	case Text::Align::Center:
+		alignment = 0.5f;
+		break;
+	case Text::Align::Right:
+		alignment = 1;
+		break;
+	default:
+		break;
+	}
+
+	Size size = _font->layout(_text, _quads, alignment);
+	this->setSize(size);
+}
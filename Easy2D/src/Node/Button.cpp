@@ -16,7 +16,12 @@ easy2d::Button::Button()
 	, _selected(nullptr)
 	, _disabled(nullptr)
 {
-	addListener(std::bind(&Button::updateStatus, this, std::placeholders::_1), L"ťܼ");
+	addListener(
+		std::bind(&Button::updateStatus, this, std::placeholders::_1),
+		L"ťܼ",
+		false,
+		EventMask::MouseMove | EventMask::MouseDown | EventMask::MouseUp
+	);
 }
 
 easy2d::Button::Button(Node * normal, const Callback& func)
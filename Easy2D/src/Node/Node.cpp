@@ -7,6 +7,12 @@
 static float s_fDefaultAnchorX = 0;
 static float s_fDefaultAnchorY = 0;
 
+// ¼ڼе±꣬Զ͵¼һ
+static inline int ListenerCountIndex(UINT type)
+{
+	return type <= easy2d::Event::Last ? int(type) : easy2d::Event::Last + 1;
+}
+
 easy2d::Node::Node()
 	: _nOrder(0)
 	, _posX(0)
@@ -22,17 +28,20 @@ easy2d::Node::Node()
 	, _realOpacity(1.0f)
 	, _anchorX(s_fDefaultAnchorX)
 	, _anchorY(s_fDefaultAnchorY)
+	, _timeScale(1.0f)
 	, _transform()
 	, _visible(true)
 	, _parent(nullptr)
 	, _parentScene(nullptr)
 	, _hashName(0)
 	, _needSort(false)
+	, _dirtyLayout(false)
 	, _dirtyTransform(false)
 	, _dirtyInverseTransform(false)
 	, _autoUpdate(true)
 	, _positionFixed(false)
 {
+	::ZeroMemory(_listenerCount, sizeof(_listenerCount));
 }
 
 easy2d::Node::~Node()
@@ -143,6 +152,9 @@ void easy2d::Node::_render()
 
 void easy2d::Node::_updateTransform() const
 {
+	// ڵߴӰĵλãŰ
+	_updateLayout();
+
 	if (!_dirtyTransform)
 		return;
 
@@ -169,6 +181,20 @@ void easy2d::Node::_updateTransform() const
 	}
 }
 
+void easy2d::Node::_invalidateLayout()
+{
+	_dirtyLayout = true;
+}
+
+void easy2d::Node::_updateLayout() const
+{
+	if (_dirtyLayout)
+	{
+		_dirtyLayout = false;
+		const_cast<Node*>(this)->_rebuildLayout();
+	}
+}
+
 void easy2d::Node::_updateInverseTransform() const
 {
 	_updateTransform();
@@ -237,26 +263,31 @@ easy2d::Point easy2d::Node::getPos() const
 
 float easy2d::Node::getWidth() const
 {
+	_updateLayout();
 	return _width * _scaleX;
 }
 
 float easy2d::Node::getHeight() const
 {
+	_updateLayout();
 	return _height * _scaleY;
 }
 
 float easy2d::Node::getRealWidth() const
 {
+	_updateLayout();
 	return _width;
 }
 
 float easy2d::Node::getRealHeight() const
 {
+	_updateLayout();
 	return _height;
 }
 
 easy2d::Size easy2d::Node::getRealSize() const
 {
+	_updateLayout();
 	return Size(_width, _height);
 }
 
@@ -305,8 +336,15 @@ float easy2d::Node::getOpacity() const
 	return _realOpacity;
 }
 
+float easy2d::Node::getTimeScale() const
+{
+	return _timeScale;
+}
+
 easy2d::Node::Property easy2d::Node::getProperty() const
 {
+	_updateLayout();
+
 	Property prop;
 	prop.visable = _visible;
 	prop.posX = _posX;
@@ -326,6 +364,7 @@ easy2d::Node::Property easy2d::Node::getProperty() const
 
 easy2d::Rect easy2d::Node::getBounds() const
 {
+	_updateLayout();
 	return Rect(Point{}, Size(_width, _height));
 }
 
@@ -462,6 +501,16 @@ void easy2d::Node::setOpacity(float opacity)
 	_updateOpacity();
 }
 
+void easy2d::Node::setTimeScale(float scale)
+{
+	if (_timeScale == scale)
+		return;
+
+	_timeScale = max(scale, 0);
+	// ͬµĲ
+	TweenManager::__updateTimeScale(this);
+}
+
 void easy2d::Node::setAnchorX(float anchorX)
 {
 	this->setAnchor(anchorX, _anchorY);
@@ -484,16 +533,21 @@ void easy2d::Node::setAnchor(float anchorX, float anchorY)
 
 void easy2d::Node::setWidth(float width)
 {
+	_updateLayout();
 	this->setSize(width, _height);
 }
 
 void easy2d::Node::setHeight(float height)
 {
+	_updateLayout();
 	this->setSize(_width, height);
 }
 
 void easy2d::Node::setSize(float width, float height)
 {
+	// δеŰ棬֮󸲸õĳߴ
+	_updateLayout();
+
 	if (_width == width && _height == height)
 		return;
 
@@ -548,6 +602,9 @@ void easy2d::Node::addChild(Node * child, int order  /* = 0 */)
 
 		child->_parent = this;
 
+		// ӽڵϵļڵ
+		__updateListenerCount(child, 1);
+
 		if (this->_parentScene)
 		{
 			child->_setParentScene(this->_parentScene);
@@ -594,6 +651,8 @@ easy2d::Scene * easy2d::Node::getParentScene() const
 
 bool easy2d::Node::containsPoint(Point const& point)
 {
+	_updateLayout();
+
 	if (_width == 0.f || _height == 0.f)
 		return false;
 
@@ -664,6 +723,7 @@ bool easy2d::Node::removeChild(Node * child)
 		auto iter = std::find(_children.begin(), _children.end(), child);
 		if (iter != _children.end())
 		{
+			__updateListenerCount(child, -1);
 			_children.erase(iter);
 			child->_parent = nullptr;
 
@@ -697,6 +757,7 @@ void easy2d::Node::removeChildren(const String& childName)
 		auto child = _children[i];
 		if (child->_hashName == hash && child->_name == childName)
 		{
+			__updateListenerCount(child, -1);
 			_children.erase(_children.begin() + i);
 			child->_parent = nullptr;
 			if (child->_parentScene)
@@ -713,6 +774,8 @@ void easy2d::Node::removeAllChildren()
 	// нڵüһ
 	for (auto child : _children)
 	{
+		__updateListenerCount(child, -1);
+		child->_parent = nullptr;
 		child->release();
 	}
 	// մڵ
@@ -788,11 +851,23 @@ void easy2d::Node::stopAllActions()
 
 void easy2d::Node::dispatch(Event* evt)
 {
+	if (evt == nullptr || Game::isPaused())
+		return;
+
+	__dispatch(evt, ListenerCountIndex(evt->type));
+}
+
+void easy2d::Node::__dispatch(Event* evt, int index)
+{
+	// ûм¼ļʱ·ַ
+	if (_listenerCount[index] == 0)
+		return;
+
 	__updateListeners(evt);
 
 	for (const auto& child : _children)
 	{
-		child->dispatch(evt);
+		child->__dispatch(evt, index);
 	}
 }
 
@@ -823,11 +898,12 @@ void easy2d::Node::_setParentScene(Scene * scene)
 	}
 }
 
-easy2d::Listener* easy2d::Node::addListener(const Listener::Callback& func, const String& name, bool paused)
+easy2d::Listener* easy2d::Node::addListener(const Listener::Callback& func, const String& name, bool paused, UINT eventMask)
 {
-	auto listener = gcnew Listener(func, name, paused);
+	auto listener = gcnew Listener(func, name, paused, eventMask);
 	GC::retain(listener);
 	_listeners.push_back(listener);
+	__updateListenerCount(eventMask, 1);
 	return listener;
 }
 
@@ -840,6 +916,7 @@ void easy2d::Node::addListener(Listener* listener)
 		{
 			GC::retain(listener);
 			_listeners.push_back(listener);
+			__updateListenerCount(listener->getEventMask(), 1);
 		}
 	}
 }
@@ -851,6 +928,7 @@ void easy2d::Node::removeListener(Listener* listener)
 		auto iter = std::find(_listeners.begin(), _listeners.end(), listener);
 		if (iter != _listeners.end())
 		{
+			__updateListenerCount(listener->getEventMask(), -1);
 			GC::release(listener);
 			_listeners.erase(iter);
 		}
@@ -925,31 +1003,66 @@ void easy2d::Node::removeAllListeners()
 
 void easy2d::Node::__updateListeners(Event* evt)
 {
-	if (_listeners.empty() || Game::isPaused())
+	if (_listeners.empty())
 		return;
 
-	for (size_t i = 0; i < _listeners.size(); ++i)
+	for (size_t i = 0; i < _listeners.size();)
 	{
 		auto listener = _listeners[i];
 		// ֹͣļ
 		if (listener->isDone())
 		{
+			__updateListenerCount(listener->getEventMask(), -1);
 			GC::release(listener);
 			_listeners.erase(_listeners.begin() + i);
 		}
 		else
 		{
-			// ¼
-			listener->handle(evt);
+			// ֻ֪ͨ¼ļ
+			if (listener->isListening(evt->type))
+			{
+				listener->handle(evt);
+			}
 			++i;
 		}
 	}
 }
 
+void easy2d::Node::__updateListenerCount(UINT eventMask, int delta)
+{
+	for (int i = 0; i <= Event::Last + 1; ++i)
+	{
+		UINT bit = (i <= Event::Last) ? (1u << i) : EventMask::Custom;
+		if (eventMask & bit)
+		{
+			for (Node * node = this; node != nullptr; node = node->_parent)
+			{
+				node->_listenerCount[i] += delta;
+			}
+		}
+	}
+}
+
+void easy2d::Node::__updateListenerCount(const Node * child, int sign)
+{
+	for (int i = 0; i <= Event::Last + 1; ++i)
+	{
+		int delta = child->_listenerCount[i] * sign;
+		if (delta != 0)
+		{
+			for (Node * node = this; node != nullptr; node = node->_parent)
+			{
+				node->_listenerCount[i] += delta;
+			}
+		}
+	}
+}
+
 void easy2d::Node::__clearListeners()
 {
 	for (auto listener : _listeners)
 	{
+		__updateListenerCount(listener->getEventMask(), -1);
 		GC::release(listener);
 	}
 	_listeners.clear();
@@ -70,7 +70,6 @@ easy2d::Text::Text(const String & text, const Font & font, const Style & style)
 
 easy2d::Text::~Text()
 {
-	SafeRelease(_textFormat);
 	SafeRelease(_textLayout);
 }
 
@@ -126,6 +125,8 @@ easy2d::LineJoin easy2d::Text::getOutlineJoin() const
 
 int easy2d::Text::getLineCount() const
 {
+	_updateLayout();
+
 	if (_textLayout)
 	{
 		DWRITE_TEXT_METRICS metrics;
@@ -250,9 +251,9 @@ void easy2d::Text::setUnderline(bool hasUnderline)
 	if (_style.hasUnderline != hasUnderline)
 	{
 		_style.hasUnderline = hasUnderline;
-		if (!_textFormat)
-			_createFormat();
-		_createLayout();
+		// »߲Ӱֳߴ磬ֱ޸в
+		if (_textLayout)
+			_textLayout->SetUnderline(hasUnderline, { 0, UINT32(_text.length()) });
 	}
 }
 
@@ -261,9 +262,8 @@ void easy2d::Text::setStrikethrough(bool hasStrikethrough)
 	if (_style.hasStrikethrough != hasStrikethrough)
 	{
 		_style.hasStrikethrough = hasStrikethrough;
-		if (!_textFormat)
-			_createFormat();
-		_createLayout();
+		if (_textLayout)
+			_textLayout->SetStrikethrough(hasStrikethrough, { 0, UINT32(_text.length()) });
 	}
 }
 
@@ -306,6 +306,12 @@ void easy2d::Text::onRender()
 }
 
 void easy2d::Text::_reset()
+{
+	// ޸ĶʱֻŰһ
+	_invalidateLayout();
+}
+
+void easy2d::Text::_rebuildLayout()
 {
 	// ָʽ
 	_createFormat();
@@ -315,52 +321,8 @@ void easy2d::Text::_reset()
 
 void easy2d::Text::_createFormat()
 {
-	SafeRelease(_textFormat);
-
-	HRESULT hr = Renderer::getIDWriteFactory()->CreateTextFormat(
-		_font.family.c_str(),
-		nullptr,
-		DWRITE_FONT_WEIGHT(_font.weight),
-		_font.italic ? DWRITE_FONT_STYLE_ITALIC : DWRITE_FONT_STYLE_NORMAL,
-		DWRITE_FONT_STRETCH_NORMAL,
-		float(_font.size),
-		L"",
-		&_textFormat
-	);
-
-	if (FAILED(hr))
-	{
-		E2D_WARNING(L"Text::_createFormat error : Create IDWriteTextFormat failed!");
-		_textFormat = nullptr;
-		return;
-	}
-	else
-	{
-		// ֶ뷽ʽ
-		_textFormat->SetTextAlignment(DWRITE_TEXT_ALIGNMENT(_style.alignment));
-		// м
-		if (_style.lineSpacing == 0.0)
-		{
-			_textFormat->SetLineSpacing(DWRITE_LINE_SPACING_METHOD_DEFAULT, 0, 0);
-		}
-		else
-		{
-			_textFormat->SetLineSpacing(
-				DWRITE_LINE_SPACING_METHOD_UNIFORM,
-				float(_style.lineSpacing),
-				float(_style.lineSpacing) * 0.8f
-			);
-		}
-		// ıԶʱû
-		if (_style.wrapping)
-		{
-			_textFormat->SetWordWrapping(DWRITE_WORD_WRAPPING_WRAP);
-		}
-		else
-		{
-			_textFormat->SetWordWrapping(DWRITE_WORD_WRAPPING_NO_WRAP);
-		}
-	}
+	// ֹͬͬһʽ뷽ʽڲ
+	_textFormat = Renderer::getTextFormat(_font);
 }
 
 void easy2d::Text::_createLayout()
@@ -383,49 +345,55 @@ void easy2d::Text::_createLayout()
 	UINT32 length = (UINT32)_text.length();
 
 	//  TextLayout
-	HRESULT hr;
-	// ıԶ½д
-	if (_style.wrapping)
+	HRESULT hr = Renderer::getIDWriteFactory()->CreateTextLayout(
+		_text.c_str(),
+		length,
+		_textFormat,
+		_style.wrapping ? float(_style.wrappingWidth) : 0,
+		0,
+		&_textLayout
+	);
+
+	if (FAILED(hr))
 	{
-		hr = Renderer::getIDWriteFactory()->CreateTextLayout(
-			_text.c_str(),
-			length,
-			_textFormat,
-			float(_style.wrappingWidth),
-			0,
-			&_textLayout
-		);
-		if (_textLayout)
-		{
-			// ȡıֵĿȺ͸߶
-			DWRITE_TEXT_METRICS metrics;
-			_textLayout->GetMetrics(&metrics);
-			// ı
-			this->setSize(metrics.layoutWidth, metrics.height);
-		}
+		E2D_WARNING(L"Text::_createLayout error : Create IDWriteTextLayout failed!");
+		_textLayout = nullptr;
+		return;
+	}
+
+	// ֶ뷽ʽ
+	_textLayout->SetTextAlignment(DWRITE_TEXT_ALIGNMENT(_style.alignment));
+	// м
+	if (_style.lineSpacing == 0.0)
+	{
+		_textLayout->SetLineSpacing(DWRITE_LINE_SPACING_METHOD_DEFAULT, 0, 0);
 	}
 	else
 	{
-		hr = Renderer::getIDWriteFactory()->CreateTextLayout(_text.c_str(), length, _textFormat, 0, 0, &_textLayout);
-		// Ϊֹı⣬ݸղŴ layout ´
-		if (_textLayout)
-		{
-			// ȡıֵĿȺ͸߶
-			DWRITE_TEXT_METRICS metrics;
-			_textLayout->GetMetrics(&metrics);
-			// ı
-			this->setSize(metrics.width, metrics.height);
-			// ´ layout
-			SafeRelease(_textLayout);
-			hr = Renderer::getIDWriteFactory()->CreateTextLayout(_text.c_str(), length, _textFormat, _width, 0, &_textLayout);
-		}
+		_textLayout->SetLineSpacing(
+			DWRITE_LINE_SPACING_METHOD_UNIFORM,
+			float(_style.lineSpacing),
+			float(_style.lineSpacing) * 0.8f
+		);
 	}
+	// û
+	_textLayout->SetWordWrapping(_style.wrapping ? DWRITE_WORD_WRAPPING_WRAP : DWRITE_WORD_WRAPPING_NO_WRAP);
 
-	if (FAILED(hr))
+	// ȡıֵĿȺ͸߶
+	DWRITE_TEXT_METRICS metrics;
+	_textLayout->GetMetrics(&metrics);
+
+	if (_style.wrapping)
 	{
-		E2D_WARNING(L"Text::_createLayout error : Create IDWriteTextLayout failed!");
-		_textLayout = nullptr;
-		return;
+		// ı
+		this->setSize(metrics.layoutWidth, metrics.height);
+	}
+	else
+	{
+		// ı
+		this->setSize(metrics.width, metrics.height);
+		// Ϊֹı⣬ֿΪı
+		_textLayout->SetMaxWidth(metrics.width);
 	}
 
 	// »ߺɾ
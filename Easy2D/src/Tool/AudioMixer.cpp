@@ -0,0 +1,464 @@
+#include <easy2d/e2dtool.h>
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#	define E2D_MIXER_SSE2
+#	include <emmintrin.h>
+#endif
+
+namespace
+{
+	const float kSampleScale = 1.f / 32768.f;
+
+	// дĻÿ֡Ѳϵ
+	std::vector<easy2d::AudioMixer*> s_vMixers;
+
+	//  PCM ۼӵ
+	void MixStereo(const short* src, float* dst, UINT32 frames, float gainL, float gainR)
+	{
+		UINT32 i = 0;
+#ifdef E2D_MIXER_SSE2
+		const __m128 gain = _mm_setr_ps(gainL, gainR, gainL, gainR);
+		for (; i + 4 <= frames; i += 4)
+		{
+			// 8  16 λչΪ 32 λ
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2));
+			__m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+			__m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16));
+
+			float* out = dst + i * 2;
+			_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(lo, gain)));
+			_mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(hi, gain)));
+		}
+#endif
+		for (; i < frames; ++i)
+		{
+			dst[i * 2] += src[i * 2] * gainL;
+			dst[i * 2 + 1] += src[i * 2 + 1] * gainR;
+		}
+	}
+
+	//  PCM ۼӵ
+	void MixMono(const short* src, float* dst, UINT32 frames, float gainL, float gainR)
+	{
+		UINT32 i = 0;
+#ifdef E2D_MIXER_SSE2
+		const __m128 gain = _mm_setr_ps(gainL, gainR, gainL, gainR);
+		for (; i + 4 <= frames; i += 4)
+		{
+			__m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+			__m128 m = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+
+			// ÿƵ
+			float* out = dst + i * 2;
+			_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_unpacklo_ps(m, m), gain)));
+			_mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_unpackhi_ps(m, m), gain)));
+		}
+#endif
+		for (; i < frames; ++i)
+		{
+			dst[i * 2] += src[i] * gainL;
+			dst[i * 2 + 1] += src[i] * gainR;
+		}
+	}
+
+	// תΪ 16 λ PCMΧĲض
+	// ·ǰģʽĬΪ˫ȡ뻺޹
+	void ConvertToPCM16(const float* src, short* dst, UINT32 count, float gain)
+	{
+		UINT32 i = 0;
+#ifdef E2D_MIXER_SSE2
+		const __m128 scale = _mm_set1_ps(gain);
+		const __m128 lower = _mm_set1_ps(-32768.f);
+		const __m128 upper = _mm_set1_ps(32767.f);
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128 a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), lower), upper);
+			__m128 b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale), lower), upper);
+			__m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			float value = src[i] * gain;
+			value = min(max(value, -32768.f), 32767.f);
+			dst[i] = static_cast<short>(::lrintf(value));
+		}
+	}
+}
+
+
+easy2d::AudioMixer::AudioMixer(UINT32 sampleRate)
+	: _masterVolume(1.f)
+	, _nextId(0)
+	, _stream(nullptr)
+{
+	ZeroMemory(&_format, sizeof(_format));
+	_format.wFormatTag = WAVE_FORMAT_PCM;
+	_format.nChannels = 2;
+	_format.nSamplesPerSec = max(sampleRate, 8000U);
+	_format.wBitsPerSample = 16;
+	_format.nBlockAlign = _format.nChannels * _format.wBitsPerSample / 8;
+	_format.nAvgBytesPerSec = _format.nSamplesPerSec * _format.nBlockAlign;
+
+	s_vMixers.push_back(this);
+}
+
+easy2d::AudioMixer::~AudioMixer()
+{
+	shutdown();
+	stopAll();
+
+	s_vMixers.erase(std::remove(s_vMixers.begin(), s_vMixers.end(), this), s_vMixers.end());
+}
+
+int easy2d::AudioMixer::play(Sound * sound, float volume, float pan, float pitch, int loopCount)
+{
+	if (sound == nullptr || !sound->isOpened())
+	{
+		E2D_WARNING(L"AudioMixer::play Failed: Sound must be opened first!");
+		return -1;
+	}
+
+	const WAVEFORMATEX * format = sound->getFormat();
+	if (format->wBitsPerSample != 16 || format->nChannels < 1 || format->nChannels > 2)
+	{
+		E2D_WARNING(L"AudioMixer::play Failed: Only 16-bit mono or stereo PCM is supported!");
+		return -1;
+	}
+
+	Voice voice;
+	voice.id = _nextId++;
+	voice.sound = sound;
+	voice.samples = reinterpret_cast<const short*>(sound->getData());
+	voice.frameCount = sound->getDataSize() / format->nBlockAlign;
+	voice.channels = format->nChannels;
+	voice.position = 0;
+	voice.rate = double(format->nSamplesPerSec) / _format.nSamplesPerSec;
+	voice.volume = volume;
+	voice.pan = min(max(pan, -1.f), 1.f);
+	voice.pitch = max(pitch, 0.f);
+	voice.loopCount = loopCount;
+	voice.finished = (voice.frameCount == 0);
+
+	// ڼ䱣Ч֤Ч
+	GC::retain(voice.sound);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_voices.push_back(voice);
+	return voice.id;
+}
+
+void easy2d::AudioMixer::stop(int id)
+{
+	Sound * sound = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (auto iter = _voices.begin(); iter != _voices.end(); ++iter)
+		{
+			if (iter->id == id)
+			{
+				sound = iter->sound;
+				_voices.erase(iter);
+				break;
+			}
+		}
+	}
+	GC::release(sound);
+}
+
+void easy2d::AudioMixer::stopAll()
+{
+	std::vector<Voice> voices;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		voices.swap(_voices);
+	}
+
+	for (auto& voice : voices)
+	{
+		GC::release(voice.sound);
+	}
+}
+
+bool easy2d::AudioMixer::isPlaying(int id)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (const auto& voice : _voices)
+	{
+		if (voice.id == id)
+			return !voice.finished;
+	}
+	return false;
+}
+
+void easy2d::AudioMixer::setVolume(int id, float volume)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (auto& voice : _voices)
+	{
+		if (voice.id == id)
+		{
+			voice.volume = volume;
+			break;
+		}
+	}
+}
+
+void easy2d::AudioMixer::setPan(int id, float pan)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (auto& voice : _voices)
+	{
+		if (voice.id == id)
+		{
+			voice.pan = min(max(pan, -1.f), 1.f);
+			break;
+		}
+	}
+}
+
+void easy2d::AudioMixer::setPitch(int id, float pitch)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (auto& voice : _voices)
+	{
+		if (voice.id == id)
+		{
+			voice.pitch = max(pitch, 0.f);
+			break;
+		}
+	}
+}
+
+void easy2d::AudioMixer::setMasterVolume(float volume)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_masterVolume = max(volume, 0.f);
+}
+
+float easy2d::AudioMixer::getMasterVolume() const
+{
+	return _masterVolume;
+}
+
+UINT32 easy2d::AudioMixer::getActiveCount()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	// Ѳϵδյ
+	UINT32 count = 0;
+	for (const auto& voice : _voices)
+	{
+		if (!voice.finished)
+			++count;
+	}
+	return count;
+}
+
+UINT32 easy2d::AudioMixer::render(BYTE * buffer, UINT32 size)
+{
+	UINT32 frames = size / _format.nBlockAlign;
+	if (frames == 0)
+		return 0;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_mixBuffer.assign(frames * 2, 0.f);
+	float* mix = &_mixBuffer[0];
+
+	for (auto& voice : _voices)
+	{
+		if (voice.finished)
+			continue;
+
+		// 񣬾ʱΪԭ
+		float gainL = voice.volume * min(1.f - voice.pan, 1.f) * kSampleScale;
+		float gainR = voice.volume * min(1.f + voice.pan, 1.f) * kSampleScale;
+		double step = voice.rate * voice.pitch;
+
+		UINT32 done = 0;
+		while (done < frames)
+		{
+			if (voice.position >= voice.frameCount)
+			{
+				if (voice.loopCount == 0)
+				{
+					voice.finished = true;
+					break;
+				}
+
+				voice.position -= voice.frameCount;
+				if (voice.loopCount > 0)
+				{
+					--voice.loopCount;
+				}
+			}
+
+			UINT32 index = static_cast<UINT32>(voice.position);
+			if (step == 1.0 && voice.position == index)
+			{
+				// زʱֱ
+				UINT32 count = min(frames - done, voice.frameCount - index);
+				if (voice.channels == 1)
+					MixMono(voice.samples + index, mix + done * 2, count, gainL, gainR);
+				else
+					MixStereo(voice.samples + index * 2, mix + done * 2, count, gainL, gainR);
+
+				voice.position += count;
+				done += count;
+			}
+			else if (step <= 0)
+			{
+				break;
+			}
+			else
+			{
+				// Բֵز
+				for (; done < frames && voice.position < voice.frameCount; ++done)
+				{
+					index = static_cast<UINT32>(voice.position);
+					UINT32 next = min(index + 1, voice.frameCount - 1);
+					float t = static_cast<float>(voice.position - index);
+
+					if (voice.channels == 1)
+					{
+						float value = voice.samples[index] + (voice.samples[next] - voice.samples[index]) * t;
+						mix[done * 2] += value * gainL;
+						mix[done * 2 + 1] += value * gainR;
+					}
+					else
+					{
+						const short* a = voice.samples + index * 2;
+						const short* b = voice.samples + next * 2;
+						mix[done * 2] += (a[0] + (b[0] - a[0]) * t) * gainL;
+						mix[done * 2 + 1] += (a[1] + (b[1] - a[1]) * t) * gainR;
+					}
+					voice.position += step;
+				}
+			}
+		}
+	}
+
+	ConvertToPCM16(mix, reinterpret_cast<short*>(buffer), frames * 2, _masterVolume * 32768.f);
+	return frames * _format.nBlockAlign;
+}
+
+bool easy2d::AudioMixer::start(AudioOutput * output, UINT32 bufferFrames)
+{
+	// ΪƵתȨ
+	class MixerDecoder :
+		public AudioDecoder
+	{
+	public:
+		explicit MixerDecoder(AudioMixer* mixer) : _mixer(mixer) {}
+
+		virtual UINT32 read(BYTE * buffer, UINT32 size) override
+		{
+			return _mixer->render(buffer, size);
+		}
+
+		virtual bool rewind() override
+		{
+			return true;
+		}
+
+	private:
+		AudioMixer* _mixer;
+	};
+
+	shutdown();
+
+	if (output == nullptr)
+	{
+		output = Music::__createAudioOutput(&_format);
+		if (output == nullptr)
+		{
+			E2D_WARNING(L"AudioMixer::start Failed: Audio device is not available!");
+			return false;
+		}
+	}
+
+	_stream = new (std::nothrow) AudioStream(
+		new MixerDecoder(this),
+		output,
+		max(bufferFrames, 256U) * _format.nBlockAlign,
+		3
+	);
+
+	if (_stream == nullptr)
+	{
+		delete output;
+		return false;
+	}
+	return _stream->play(-1);
+}
+
+void easy2d::AudioMixer::shutdown()
+{
+	if (_stream)
+	{
+		delete _stream;
+		_stream = nullptr;
+	}
+}
+
+const WAVEFORMATEX * easy2d::AudioMixer::getFormat() const
+{
+	return &_format;
+}
+
+void easy2d::AudioMixer::_collect()
+{
+	std::vector<Sound*> finished;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (size_t i = 0; i < _voices.size();)
+		{
+			if (_voices[i].finished)
+			{
+				finished.push_back(_voices[i].sound);
+				_voices.erase(_voices.begin() + i);
+			}
+			else
+			{
+				++i;
+			}
+		}
+	}
+
+	for (auto sound : finished)
+	{
+		GC::release(sound);
+	}
+}
+
+void easy2d::AudioMixer::__update()
+{
+	for (auto mixer : s_vMixers)
+	{
+		mixer->_collect();
+	}
+}
+
+void easy2d::AudioMixer::__stop(Sound * sound)
+{
+	if (sound == nullptr)
+		return;
+
+	for (auto mixer : s_vMixers)
+	{
+		std::lock_guard<std::mutex> lock(mixer->_mutex);
+		for (auto& voice : mixer->_voices)
+		{
+			if (voice.sound == sound)
+			{
+				// ʱѽٶȡЧ
+				voice.finished = true;
+				voice.samples = nullptr;
+			}
+		}
+	}
+}
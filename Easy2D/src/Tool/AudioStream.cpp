@@ -0,0 +1,400 @@
+#include <easy2d/e2dtool.h>
+
+
+easy2d::NullAudioOutput::NullAudioOutput(UINT32 bytesPerSecond)
+	: _bytesPerSecond(bytesPerSecond)
+	, _started(false)
+	, _submittedCount(0)
+	, _playedBytes(0)
+	, _pendingBytes(0)
+{
+}
+
+bool easy2d::NullAudioOutput::submit(const BYTE * data, UINT32 size, bool endOfStream)
+{
+	if (size == 0)
+		return true;
+
+	_queue.push_back(size);
+	++_submittedCount;
+	return true;
+}
+
+UINT32 easy2d::NullAudioOutput::getQueuedCount()
+{
+	_consume();
+	return static_cast<UINT32>(_queue.size());
+}
+
+bool easy2d::NullAudioOutput::start()
+{
+	if (!_started)
+	{
+		_started = true;
+		_lastTime = std::chrono::steady_clock::now();
+	}
+	return true;
+}
+
+void easy2d::NullAudioOutput::stop()
+{
+	_consume();
+	_started = false;
+}
+
+void easy2d::NullAudioOutput::flush()
+{
+	_queue.clear();
+	_pendingBytes = 0;
+}
+
+UINT32 easy2d::NullAudioOutput::getSubmittedCount() const
+{
+	return _submittedCount;
+}
+
+UINT64 easy2d::NullAudioOutput::getPlayedBytes() const
+{
+	return _playedBytes;
+}
+
+void easy2d::NullAudioOutput::_consume()
+{
+	if (!_started)
+		return;
+
+	if (_bytesPerSecond == 0)
+	{
+		for (auto size : _queue)
+		{
+			_playedBytes += size;
+		}
+		_queue.clear();
+		return;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration_cast<std::chrono::microseconds>(now - _lastTime).count() / 1000000.0;
+	_lastTime = now;
+	_pendingBytes += seconds * _bytesPerSecond;
+
+	while (!_queue.empty() && _pendingBytes >= _queue.front())
+	{
+		_pendingBytes -= _queue.front();
+		_playedBytes += _queue.front();
+		_queue.pop_front();
+	}
+
+	// Ϊʱ۲ʱ
+	if (_queue.empty())
+	{
+		_pendingBytes = 0;
+	}
+}
+
+
+easy2d::WaveFileOutput::WaveFileOutput(const String & filePath, const WAVEFORMATEX * format)
+	: _file(INVALID_HANDLE_VALUE)
+	, _dataSize(0)
+{
+	if (format == nullptr)
+	{
+		E2D_WARNING(L"WaveFileOutput: Invalid format.");
+		return;
+	}
+
+	const BYTE* begin = reinterpret_cast<const BYTE*>(format);
+	_format.assign(begin, begin + sizeof(WAVEFORMATEX) + format->cbSize);
+
+	_file = ::CreateFileW(filePath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (_file == INVALID_HANDLE_VALUE)
+	{
+		E2D_WARNING(L"WaveFileOutput: Create file failed.");
+		return;
+	}
+
+	// дռλļͷرʱٲݴС
+	_writeHeader();
+}
+
+easy2d::WaveFileOutput::~WaveFileOutput()
+{
+	if (_file != INVALID_HANDLE_VALUE)
+	{
+		::SetFilePointer(_file, 0, nullptr, FILE_BEGIN);
+		_writeHeader();
+		::CloseHandle(_file);
+	}
+}
+
+bool easy2d::WaveFileOutput::submit(const BYTE * data, UINT32 size, bool endOfStream)
+{
+	if (_file == INVALID_HANDLE_VALUE)
+		return false;
+
+	if (size == 0)
+		return true;
+
+	DWORD written = 0;
+	if (!::WriteFile(_file, data, size, &written, nullptr) || written != size)
+		return false;
+
+	_dataSize += size;
+	return true;
+}
+
+UINT32 easy2d::WaveFileOutput::getQueuedCount()
+{
+	// ύʱдļ
+	return 0;
+}
+
+bool easy2d::WaveFileOutput::start()
+{
+	return _file != INVALID_HANDLE_VALUE;
+}
+
+void easy2d::WaveFileOutput::stop()
+{
+}
+
+void easy2d::WaveFileOutput::flush()
+{
+}
+
+bool easy2d::WaveFileOutput::isOpened() const
+{
+	return _file != INVALID_HANDLE_VALUE;
+}
+
+UINT32 easy2d::WaveFileOutput::getDataSize() const
+{
+	return _dataSize;
+}
+
+void easy2d::WaveFileOutput::_writeHeader()
+{
+	UINT32 formatSize = static_cast<UINT32>(_format.size());
+	UINT32 riffSize = 4 + (8 + formatSize) + (8 + _dataSize);
+
+	std::vector<BYTE> header;
+	auto append = [&](const void* data, size_t size)
+	{
+		const BYTE* p = static_cast<const BYTE*>(data);
+		header.insert(header.end(), p, p + size);
+	};
+
+	append("RIFF", 4);
+	append(&riffSize, 4);
+	append("WAVE", 4);
+	append("fmt ", 4);
+	append(&formatSize, 4);
+	append(&_format[0], formatSize);
+	append("data", 4);
+	append(&_dataSize, 4);
+
+	DWORD written = 0;
+	::WriteFile(_file, &header[0], static_cast<DWORD>(header.size()), &written, nullptr);
+}
+
+
+easy2d::AudioStream::AudioStream(AudioDecoder * decoder, AudioOutput * output, UINT32 bufferSize, UINT32 bufferCount)
+	: _decoder(decoder)
+	, _output(output)
+	, _bufferSize(max(bufferSize, 1024U))
+	, _bufferCount(max(bufferCount, 2U))
+	, _nextBuffer(0)
+	, _loopCount(0)
+	, _ended(true)
+	, _playing(false)
+	, _signaled(false)
+	, _quit(false)
+{
+	_ring.resize(static_cast<size_t>(_bufferSize) * _bufferCount);
+	_thread = std::thread(&AudioStream::_run, this);
+}
+
+easy2d::AudioStream::~AudioStream()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_quit = true;
+	}
+	_cond.notify_one();
+
+	if (_thread.joinable())
+	{
+		_thread.join();
+	}
+
+	if (_output)
+	{
+		_output->stop();
+		_output->flush();
+	}
+
+	delete _output;
+	delete _decoder;
+}
+
+bool easy2d::AudioStream::play(int loopCount)
+{
+	if (!_decoder || !_output)
+		return false;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_playing = false;
+	_output->stop();
+	_output->flush();
+
+	if (!_decoder->rewind())
+		return false;
+
+	_loopCount = loopCount;
+	_nextBuffer = 0;
+	_ended = false;
+
+	// ֤ͬʼʱ
+	_pump();
+
+	if (!_output->start())
+		return false;
+
+	_playing = true;
+	_cond.notify_one();
+	return true;
+}
+
+void easy2d::AudioStream::pause()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_playing)
+	{
+		_output->stop();
+		_playing = false;
+	}
+}
+
+void easy2d::AudioStream::resume()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (!_playing && !_ended)
+	{
+		if (_output->start())
+		{
+			_playing = true;
+			_cond.notify_one();
+		}
+	}
+}
+
+void easy2d::AudioStream::stop()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_playing = false;
+	_ended = true;
+	_output->stop();
+	_output->flush();
+}
+
+bool easy2d::AudioStream::isPlaying() const
+{
+	return _playing;
+}
+
+bool easy2d::AudioStream::isPaused()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return !_playing && !_ended;
+}
+
+void easy2d::AudioStream::notify()
+{
+	// Ƶ豸߳еãﲻʱ̨߳ӳһȴ
+	_signaled = true;
+	_cond.notify_one();
+}
+
+size_t easy2d::AudioStream::getMemoryUsage() const
+{
+	return _ring.size();
+}
+
+void easy2d::AudioStream::_run()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_quit)
+	{
+		if (_playing)
+		{
+			// 豸֪ͨϣʱԶʱһ
+			_cond.wait_for(lock, std::chrono::milliseconds(10), [this]() { return _quit || _signaled; });
+		}
+		else
+		{
+			// ûвʱһֱȴֱ play  resume
+			_cond.wait(lock, [this]() { return _quit || _playing; });
+		}
+		_signaled = false;
+
+		if (_quit)
+			break;
+
+		if (!_playing)
+			continue;
+
+		_pump();
+
+		// һ
+		if (_ended && _output->getQueuedCount() == 0)
+		{
+			_playing = false;
+		}
+	}
+}
+
+void easy2d::AudioStream::_pump()
+{
+	// ÿһֻⲻŶӵ豸ļʹ߳޷ֹͣ
+	for (UINT32 i = 0; i < _bufferCount && !_ended && _output->getQueuedCount() < _bufferCount; ++i)
+	{
+		// ύĻѾ꣬ʹ
+		BYTE * buffer = &_ring[static_cast<size_t>(_nextBuffer) * _bufferSize];
+		UINT32 filled = 0;
+		bool rewound = false;
+
+		while (filled < _bufferSize)
+		{
+			UINT32 count = _decoder->read(buffer + filled, _bufferSize - filled);
+			if (count > 0)
+			{
+				filled += count;
+				rewound = false;
+				continue;
+			}
+
+			// ݶ꣬ʣѭǷͷʼ
+			if (_loopCount != 0 && !rewound && _decoder->rewind())
+			{
+				if (_loopCount > 0)
+				{
+					--_loopCount;
+				}
+				rewound = true;
+				continue;
+			}
+
+			_ended = true;
+			break;
+		}
+
+		if (!_output->submit(buffer, filled, _ended))
+		{
+			E2D_WARNING(L"AudioStream submit buffer failed!");
+			_ended = true;
+			break;
+		}
+		_nextBuffer = (_nextBuffer + 1) % _bufferCount;
+	}
+}
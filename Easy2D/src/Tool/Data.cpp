@@ -1,48 +1,562 @@
 #include <easy2d/e2dtool.h>
+#include <fstream>
+#include <unordered_map>
+#include <cwctype>
 
+using namespace std::chrono;
+
+namespace
+{
+	// ļеһ
+	struct DataEntry
+	{
+		easy2d::String key;
+		easy2d::String value;
+	};
+
+	// ļеһֶΣ GetPrivateProfileString һ£
+	// ֶͼִСд
+	struct DataSection
+	{
+		easy2d::String name;
+		std::vector<DataEntry> entries;
+		std::unordered_map<easy2d::String, size_t> index;
+	};
+
+	easy2d::String ToLower(const easy2d::String& str)
+	{
+		easy2d::String result(str);
+		for (auto& ch : result)
+		{
+			ch = static_cast<wchar_t>(std::towlower(ch));
+		}
+		return result;
+	}
+
+	easy2d::String Trim(const easy2d::String& str)
+	{
+		size_t begin = str.find_first_not_of(L" \t");
+		if (begin == easy2d::String::npos)
+			return easy2d::String();
+
+		size_t end = str.find_last_not_of(L" \t");
+		return str.substr(begin, end - begin + 1);
+	}
+
+	// ڴе INI ĵֶκͼԭ˳
+	class DataStore
+	{
+	public:
+		void clear()
+		{
+			_sections.clear();
+			_index.clear();
+		}
+
+		const easy2d::String* get(const easy2d::String& field, const easy2d::String& key) const
+		{
+			auto sectionIter = _index.find(ToLower(field));
+			if (sectionIter == _index.end())
+				return nullptr;
+
+			const DataSection& section = _sections[sectionIter->second];
+			auto entryIter = section.index.find(ToLower(key));
+			if (entryIter == section.index.end())
+				return nullptr;
+
+			return &section.entries[entryIter->second].value;
+		}
+
+		// ֵб仯ʱ true
+		bool set(const easy2d::String& field, const easy2d::String& key, const easy2d::String& value, bool overwrite = true)
+		{
+			DataSection& section = _getSection(field);
+
+			easy2d::String lowerKey = ToLower(key);
+			auto iter = section.index.find(lowerKey);
+			if (iter != section.index.end())
+			{
+				easy2d::String& oldValue = section.entries[iter->second].value;
+				if (!overwrite || oldValue == value)
+					return false;
+
+				oldValue = value;
+				return true;
+			}
+
+			DataEntry entry = { key, value };
+			section.index.insert(std::make_pair(lowerKey, section.entries.size()));
+			section.entries.push_back(entry);
+			return true;
+		}
+
+		// һĵеֵд뵱ǰĵеļ
+		void merge(const DataStore& other)
+		{
+			for (const auto& section : other._sections)
+			{
+				for (const auto& entry : section.entries)
+				{
+					set(section.name, entry.key, entry.value);
+				}
+			}
+		}
+
+		void parse(const easy2d::String& text)
+		{
+			clear();
+
+			easy2d::String field;
+			bool hasField = false;
+
+			size_t pos = 0;
+			while (pos < text.size())
+			{
+				size_t end = text.find(L'\n', pos);
+				if (end == easy2d::String::npos)
+					end = text.size();
+
+				easy2d::String line = Trim(text.substr(pos, end - pos));
+				pos = end + 1;
+
+				if (!line.empty() && line[line.size() - 1] == L'\r')
+					line = Trim(line.substr(0, line.size() - 1));
+
+				if (line.empty() || line[0] == L';')
+					continue;
+
+				if (line[0] == L'[')
+				{
+					size_t close = line.find(L']');
+					field = Trim(line.substr(1, close == easy2d::String::npos ? easy2d::String::npos : close - 1));
+					hasField = true;
+					continue;
+				}
+
+				size_t equal = line.find(L'=');
+				if (!hasField || equal == easy2d::String::npos)
+					continue;
+
+				easy2d::String key = Trim(line.substr(0, equal));
+				easy2d::String value = Trim(line.substr(equal + 1));
+				//  GetPrivateProfileString һ£ȥֵ
+				if (value.size() >= 2 && value[0] == L'"' && value[value.size() - 1] == L'"')
+					value = value.substr(1, value.size() - 2);
+
+				// ظļԵһΪ׼
+				if (!key.empty())
+					set(field, key, value, false);
+			}
+		}
+
+		easy2d::String serialize() const
+		{
+			easy2d::String text;
+			for (const auto& section : _sections)
+			{
+				if (!text.empty())
+					text.append(L"\r\n");
+
+				text.append(L"[").append(section.name).append(L"]\r\n");
+				for (const auto& entry : section.entries)
+				{
+					text.append(entry.key).append(L"=").append(entry.value).append(L"\r\n");
+				}
+			}
+			return text;
+		}
+
+	private:
+		DataSection& _getSection(const easy2d::String& field)
+		{
+			easy2d::String lowerField = ToLower(field);
+			auto iter = _index.find(lowerField);
+			if (iter != _index.end())
+				return _sections[iter->second];
+
+			_index.insert(std::make_pair(lowerField, _sections.size()));
+			_sections.push_back(DataSection());
+			_sections.back().name = field;
+			return _sections.back();
+		}
+
+	private:
+		std::vector<DataSection> _sections;
+		std::unordered_map<easy2d::String, size_t> _index;
+	};
+
+	// ļ֧ UTF-16 LE  UTF-8 BOMû BOM ʱ ANSI 
+	easy2d::String DecodeText(const std::vector<BYTE>& bytes)
+	{
+		easy2d::String text;
+		size_t size = bytes.size();
+
+		if (size >= 2 && bytes[0] == 0xFF && bytes[1] == 0xFE)
+		{
+			text.reserve(size / 2);
+			for (size_t i = 2; i + 1 < size; i += 2)
+			{
+				UINT32 unit = bytes[i] | (bytes[i + 1] << 8);
+				if (sizeof(wchar_t) > 2 && unit >= 0xD800 && unit < 0xDC00 && i + 3 < size)
+				{
+					UINT32 low = bytes[i + 2] | (bytes[i + 3] << 8);
+					if (low >= 0xDC00 && low < 0xE000)
+					{
+						unit = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+						i += 2;
+					}
+				}
+				text.push_back(static_cast<wchar_t>(unit));
+			}
+		}
+		else if (size >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+		{
+			text.reserve(size);
+			for (size_t i = 3; i < size;)
+			{
+				UINT32 ch = bytes[i];
+				int extra = (ch >= 0xF0) ? 3 : (ch >= 0xE0) ? 2 : (ch >= 0xC0) ? 1 : 0;
+				ch &= (extra == 0) ? 0x7F : (0x3F >> extra);
+				for (int j = 1; j <= extra && i + j < size; ++j)
+				{
+					ch = (ch << 6) | (bytes[i + j] & 0x3F);
+				}
+				i += extra + 1;
+
+				if (sizeof(wchar_t) == 2 && ch >= 0x10000)
+				{
+					ch -= 0x10000;
+					text.push_back(static_cast<wchar_t>(0xD800 + (ch >> 10)));
+					text.push_back(static_cast<wchar_t>(0xDC00 + (ch & 0x3FF)));
+				}
+				else
+				{
+					text.push_back(static_cast<wchar_t>(ch));
+				}
+			}
+		}
+		else if (size > 0)
+		{
+			text = easy2d::NarrowToWide(easy2d::ByteString(bytes.begin(), bytes.end()));
+		}
+		return text;
+	}
+
+	// Ϊ BOM  UTF-16 LEWindows  INI ֱӶдļ
+	void EncodeText(const easy2d::String& text, std::vector<BYTE>& bytes)
+	{
+		bytes.clear();
+		bytes.reserve(text.size() * 2 + 2);
+		bytes.push_back(0xFF);
+		bytes.push_back(0xFE);
+
+		for (auto ch : text)
+		{
+			UINT32 unit = static_cast<UINT32>(ch);
+			if (unit >= 0x10000)
+			{
+				unit -= 0x10000;
+				UINT32 high = 0xD800 + (unit >> 10);
+				bytes.push_back(BYTE(high & 0xFF));
+				bytes.push_back(BYTE(high >> 8));
+				unit = 0xDC00 + (unit & 0x3FF);
+			}
+			bytes.push_back(BYTE(unit & 0xFF));
+			bytes.push_back(BYTE(unit >> 8));
+		}
+	}
+
+	bool ReadFileBytes(const easy2d::String& filePath, std::vector<BYTE>& bytes)
+	{
+		std::ifstream in(filePath, std::ios::binary);
+		if (!in)
+			return false;
+
+		in.seekg(0, std::ios::end);
+		std::streamoff size = in.tellg();
+		in.seekg(0, std::ios::beg);
+		if (size <= 0)
+			return false;
+
+		bytes.resize(static_cast<size_t>(size));
+		in.read(reinterpret_cast<char*>(&bytes[0]), size);
+		return in.gcount() == size;
+	}
+
+	std::mutex s_Mutex;
+	std::condition_variable s_WriterCond;	// Ѻ̨߳
+	std::condition_variable s_DoneCond;		// ֪ͨд
+	std::thread s_Thread;
+	DataStore s_Store;
+	easy2d::String s_sFilePath;
+	bool s_bLoaded = false;
+	bool s_bDirty = false;
+	bool s_bWriting = false;
+	bool s_bFlushRequested = false;
+	bool s_bQuit = false;
+	UINT32 s_nWriteCount = 0;				// ѽдʧܵд
+	float s_fFlushInterval = 5.f;
+	steady_clock::time_point s_tDirtySince;
+
+	// ״ηʱȡļǰ s_Mutex
+	// Path ʼǰļ·Ϊգʱֻڴжд֮ķ·ʱٺϲļе
+	void EnsureLoaded()
+	{
+		if (s_bLoaded)
+			return;
+
+		s_sFilePath = easy2d::Path::getDataSavePath();
+		if (s_sFilePath.empty())
+			return;
+
+		s_bLoaded = true;
+
+		std::vector<BYTE> bytes;
+		if (ReadFileBytes(s_sFilePath, bytes))
+		{
+			DataStore stored;
+			stored.parse(DecodeText(bytes));
+			// ·ǰдֵ
+			stored.merge(s_Store);
+			s_Store = std::move(stored);
+		}
+	}
+
+	void WriterLoop()
+	{
+		std::unique_lock<std::mutex> lock(s_Mutex);
+		while (true)
+		{
+			// ·дʱȷδʼʱд룬⸲ǻδȡļ
+			bool due = s_bDirty && !s_sFilePath.empty() && (s_bFlushRequested || s_bQuit ||
+				(s_fFlushInterval > 0 && steady_clock::now() - s_tDirtySince >= duration<float>(s_fFlushInterval)));
+
+			if (due)
+			{
+				std::vector<BYTE> bytes;
+				EncodeText(s_Store.serialize(), bytes);
+				easy2d::String filePath = s_sFilePath;
+
+				s_bDirty = false;
+				s_bFlushRequested = false;
+				s_bWriting = true;
+
+				// дļʱ̵߳Ķд
+				lock.unlock();
+				bool succeeded = easy2d::Path::writeFileAtomic(filePath, &bytes[0], bytes.size());
+				lock.lock();
+
+				s_bWriting = false;
+				++s_nWriteCount;
+
+				if (!succeeded)
+				{
+					// ޸ģһ
+					s_bDirty = true;
+					s_tDirtySince = steady_clock::now();
+					E2D_WARNING(L"Data: failed to write the data file!");
+				}
+				s_DoneCond.notify_all();
+
+				// ˳ʱԣԱΪ޸ģ֮ flush ʱд
+				if (!succeeded && s_bQuit)
+					break;
+
+				continue;
+			}
+
+			s_bFlushRequested = false;
+			s_DoneCond.notify_all();
+
+			if (s_bQuit)
+			{
+				if (s_bDirty)
+				{
+					E2D_WARNING(L"Data: the data file path is not available, changes are not saved!");
+				}
+				break;
+			}
+
+			if (s_bDirty && s_fFlushInterval > 0)
+			{
+				s_WriterCond.wait_until(lock, s_tDirtySince + duration_cast<steady_clock::duration>(duration<float>(s_fFlushInterval)));
+			}
+			else
+			{
+				s_WriterCond.wait(lock);
+			}
+		}
+	}
+
+	// Ѻ̨̣߳߳δʱǰ s_Mutex
+	void WakeWriter()
+	{
+		if (!s_Thread.joinable())
+		{
+			s_Thread = std::thread(WriterLoop);
+		}
+		s_WriterCond.notify_one();
+	}
+
+	// ޸ģǰ s_Mutex
+	void MarkDirty()
+	{
+		if (s_bDirty)
+			return;
+
+		s_bDirty = true;
+		s_tDirtySince = steady_clock::now();
+		WakeWriter();
+	}
+
+	void SetValue(const easy2d::String& field, const easy2d::String& key, const easy2d::String& value)
+	{
+		std::lock_guard<std::mutex> lock(s_Mutex);
+		EnsureLoaded();
+		if (s_Store.set(field, key, value))
+		{
+			MarkDirty();
+		}
+	}
+
+	bool GetValue(const easy2d::String& field, const easy2d::String& key, easy2d::String& value)
+	{
+		std::lock_guard<std::mutex> lock(s_Mutex);
+		EnsureLoaded();
+
+		const easy2d::String* found = s_Store.get(field, key);
+		if (found)
+		{
+			value = *found;
+			return true;
+		}
+		return false;
+	}
+
+	// дݲ̨߳
+	void StopWriter()
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_Mutex);
+			if (!s_Thread.joinable())
+				return;
+
+			EnsureLoaded();
+			s_bQuit = true;
+			s_WriterCond.notify_one();
+		}
+
+		s_Thread.join();
+
+		std::lock_guard<std::mutex> lock(s_Mutex);
+		s_bQuit = false;
+	}
+
+	// ˳ʱûе Game::destroyд
+	struct DataWriterGuard
+	{
+		~DataWriterGuard()
+		{
+			StopWriter();
+		}
+	} s_WriterGuard;
+}
 
 void easy2d::Data::saveInt(const String& key, int value, const String& field)
 {
-	::WritePrivateProfileString(field.c_str(), key.c_str(), std::to_wstring(value).c_str(), Path::getDataSavePath().c_str());
+	SetValue(field, key, std::to_wstring(value));
 }
 
 void easy2d::Data::saveDouble(const String& key, float value, const String& field)
 {
-	::WritePrivateProfileString(field.c_str(), key.c_str(), std::to_wstring(value).c_str(), Path::getDataSavePath().c_str());
+	SetValue(field, key, std::to_wstring(value));
 }
 
 void easy2d::Data::saveBool(const String& key, bool value, const String& field)
 {
-	::WritePrivateProfileString(field.c_str(), key.c_str(), (value ? L"1" : L"0"), Path::getDataSavePath().c_str());
+	SetValue(field, key, (value ? L"1" : L"0"));
 }
 
 void easy2d::Data::saveString(const String& key, const String& value, const String& field)
 {
-	::WritePrivateProfileString(field.c_str(), key.c_str(), value.c_str(), Path::getDataSavePath().c_str());
+	SetValue(field, key, value);
 }
 
 int easy2d::Data::getInt(const String& key, int defaultValue, const String& field)
 {
-	return ::GetPrivateProfileInt(field.c_str(), key.c_str(), defaultValue, Path::getDataSavePath().c_str());
+	String value;
+	if (!GetValue(field, key, value))
+		return defaultValue;
+
+	return static_cast<int>(std::wcstol(value.c_str(), nullptr, 10));
 }
 
 float easy2d::Data::getDouble(const String& key, float defaultValue, const String& field)
 {
-	wchar_t temp[32] = { 0 };
-	::GetPrivateProfileString(field.c_str(), key.c_str(), std::to_wstring(defaultValue).c_str(), temp, 31, Path::getDataSavePath().c_str());
-	return std::stof(temp);
+	String value;
+	if (!GetValue(field, key, value))
+		return defaultValue;
+
+	return std::wcstof(value.c_str(), nullptr);
 }
 
 bool easy2d::Data::getBool(const String& key, bool defaultValue, const String& field)
 {
-	int nDefaultValue = defaultValue ? 1 : 0;
-	int nValue = ::GetPrivateProfileInt(field.c_str(), key.c_str(), nDefaultValue, Path::getDataSavePath().c_str());
-	return nValue != 0;
+	String value;
+	if (!GetValue(field, key, value))
+		return defaultValue;
+
+	return std::wcstol(value.c_str(), nullptr, 10) != 0;
 }
 
 easy2d::String easy2d::Data::getString(const String& key, const String& defaultValue, const String& field)
 {
-	wchar_t temp[256] = { 0 };
-	::GetPrivateProfileString(field.c_str(), key.c_str(), defaultValue.c_str(), temp, 255, Path::getDataSavePath().c_str());
-	return temp;
-}
\ No newline at end of file
+	String value;
+	if (!GetValue(field, key, value))
+		return defaultValue;
+
+	return value;
+}
+
+void easy2d::Data::flush(bool wait)
+{
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	EnsureLoaded();
+	if (!s_bDirty && !s_bWriting)
+		return;
+
+	if (s_bDirty && s_sFilePath.empty())
+	{
+		E2D_WARNING(L"Data::flush Failed: the data file path is not available yet!");
+		return;
+	}
+
+	// ڽедܲµ޸ģҪٵһд룬дʧʱͬ
+	UINT32 target = s_nWriteCount + (s_bWriting ? 1 : 0) + (s_bDirty ? 1 : 0);
+
+	s_bFlushRequested = true;
+	WakeWriter();
+
+	if (wait)
+	{
+		s_DoneCond.wait(lock, [target]() { return s_nWriteCount >= target; });
+	}
+}
+
+void easy2d::Data::setFlushInterval(float seconds)
+{
+	std::lock_guard<std::mutex> lock(s_Mutex);
+	s_fFlushInterval = max(seconds, 0);
+	s_WriterCond.notify_one();
+}
+
+bool easy2d::Data::isDirty()
+{
+	std::lock_guard<std::mutex> lock(s_Mutex);
+	return s_bDirty || s_bWriting;
+}
+
+void easy2d::Data::__uninit()
+{
+	StopWriter();
+}
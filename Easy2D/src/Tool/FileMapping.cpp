@@ -0,0 +1,96 @@
+#include <easy2d/e2dtool.h>
+#include <cstdint>
+
+
+easy2d::FileMapping::FileMapping()
+	: _file(INVALID_HANDLE_VALUE)
+	, _mapping(nullptr)
+	, _view(nullptr)
+	, _size(0)
+{
+}
+
+easy2d::FileMapping::~FileMapping()
+{
+	close();
+}
+
+bool easy2d::FileMapping::open(const String & filePath)
+{
+	close();
+
+	_file = ::CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (_file == INVALID_HANDLE_VALUE)
+		return false;
+
+	// ļҪӳ䵽ַռ
+	LARGE_INTEGER fileSize = { 0 };
+	bool succeeded = ::GetFileSizeEx(_file, &fileSize) && fileSize.QuadPart > 0 && UINT64(fileSize.QuadPart) <= SIZE_MAX;
+
+	if (succeeded)
+	{
+		_mapping = ::CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		succeeded = (_mapping != nullptr);
+	}
+
+	if (succeeded)
+	{
+		_view = ::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+		succeeded = (_view != nullptr);
+	}
+
+	if (!succeeded)
+	{
+		close();
+		return false;
+	}
+
+	_size = static_cast<size_t>(fileSize.QuadPart);
+	return true;
+}
+
+void easy2d::FileMapping::close()
+{
+	if (_view)
+	{
+		::UnmapViewOfFile(_view);
+		_view = nullptr;
+	}
+
+	if (_mapping)
+	{
+		::CloseHandle(_mapping);
+		_mapping = nullptr;
+	}
+
+	if (_file != INVALID_HANDLE_VALUE)
+	{
+		::CloseHandle(_file);
+		_file = INVALID_HANDLE_VALUE;
+	}
+
+	_size = 0;
+}
+
+bool easy2d::FileMapping::isOpened() const
+{
+	return _view != nullptr;
+}
+
+const BYTE * easy2d::FileMapping::getData() const
+{
+	return static_cast<const BYTE*>(_view);
+}
+
+size_t easy2d::FileMapping::getSize() const
+{
+	return _size;
+}
+
+void easy2d::FileMapping::swap(FileMapping & other)
+{
+	std::swap(_file, other._file);
+	std::swap(_mapping, other._mapping);
+	std::swap(_view, other._view);
+	std::swap(_size, other._size);
+}
@@ -28,6 +28,300 @@ namespace
 {
 	IXAudio2* s_pXAudio2 = nullptr;
 	IXAudio2MasteringVoice* s_pMasteringVoice = nullptr;
+	float s_fStreamingThreshold = 10.f;
+
+	// ȡƵʱ100 룩
+	LONGLONG GetDuration(IMFSourceReader* reader)
+	{
+		PROPVARIANT prop;
+		PropVariantInit(&prop);
+
+		LONGLONG duration = 0;
+		if (SUCCEEDED(reader->GetPresentationAttribute((DWORD)MF_SOURCE_READER_MEDIASOURCE, MF_PD_DURATION, &prop)))
+		{
+			duration = prop.uhVal.QuadPart;
+		}
+		PropVariantClear(&prop);
+		return duration;
+	}
+
+	// ʹ Media Foundation ֿ
+	class MediaDecoder :
+		public easy2d::AudioDecoder
+	{
+	public:
+		explicit MediaDecoder(IMFSourceReader* reader)
+			: _reader(reader)
+			, _offset(0)
+		{
+			_reader->AddRef();
+		}
+
+		virtual ~MediaDecoder()
+		{
+			easy2d::SafeRelease(_reader);
+		}
+
+		virtual UINT32 read(BYTE * buffer, UINT32 size) override
+		{
+			UINT32 count = 0;
+			while (count < size)
+			{
+				// ʹϴνʣ
+				if (_offset < _pending.size())
+				{
+					UINT32 n = min(size - count, static_cast<UINT32>(_pending.size() - _offset));
+					memcpy(buffer + count, &_pending[_offset], n);
+					_offset += n;
+					count += n;
+					continue;
+				}
+
+				if (!_decodeSample())
+					break;
+			}
+			return count;
+		}
+
+		virtual bool rewind() override
+		{
+			PROPVARIANT prop;
+			PropVariantInit(&prop);
+			prop.vt = VT_I8;
+			prop.hVal.QuadPart = 0;
+
+			HRESULT hr = _reader->SetCurrentPosition(GUID_NULL, prop);
+			PropVariantClear(&prop);
+
+			_pending.clear();
+			_offset = 0;
+			return SUCCEEDED(hr);
+		}
+
+	private:
+		bool _decodeSample()
+		{
+			_pending.clear();
+			_offset = 0;
+
+			while (_pending.empty())
+			{
+				DWORD flags = 0;
+				IMFSample* sample = nullptr;
+
+				HRESULT hr = _reader->ReadSample((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM, 0, nullptr, &flags, nullptr, &sample);
+				if (FAILED(hr) || (flags & MF_SOURCE_READERF_ENDOFSTREAM))
+				{
+					easy2d::SafeRelease(sample);
+					return false;
+				}
+
+				if (sample == nullptr)
+					continue;
+
+				IMFMediaBuffer* mediaBuffer = nullptr;
+				if (SUCCEEDED(sample->ConvertToContiguousBuffer(&mediaBuffer)))
+				{
+					BYTE* data = nullptr;
+					DWORD length = 0;
+					if (SUCCEEDED(mediaBuffer->Lock(&data, nullptr, &length)))
+					{
+						_pending.assign(data, data + length);
+						mediaBuffer->Unlock();
+					}
+				}
+
+				easy2d::SafeRelease(mediaBuffer);
+				easy2d::SafeRelease(sample);
+			}
+			return true;
+		}
+
+	private:
+		IMFSourceReader* _reader;
+		std::vector<BYTE> _pending;
+		size_t _offset;
+	};
+
+	// ͨ XAudio2 Դ
+	class VoiceOutput :
+		public easy2d::AudioOutput
+	{
+	public:
+		explicit VoiceOutput(IXAudio2SourceVoice* voice, bool owned = false)
+			: _voice(voice)
+			, _owned(owned)
+		{
+		}
+
+		virtual ~VoiceOutput()
+		{
+			if (_owned)
+			{
+				_voice->Stop();
+				_voice->FlushSourceBuffers();
+				_voice->DestroyVoice();
+			}
+		}
+
+		virtual bool submit(const BYTE * data, UINT32 size, bool endOfStream) override
+		{
+			if (size == 0)
+			{
+				return SUCCEEDED(_voice->Discontinuity());
+			}
+
+			XAUDIO2_BUFFER buffer = { 0 };
+			buffer.pAudioData = data;
+			buffer.AudioBytes = size;
+			buffer.Flags = endOfStream ? XAUDIO2_END_OF_STREAM : 0;
+			return SUCCEEDED(_voice->SubmitSourceBuffer(&buffer));
+		}
+
+		virtual UINT32 getQueuedCount() override
+		{
+			XAUDIO2_VOICE_STATE state;
+			_voice->GetState(&state);
+			return state.BuffersQueued;
+		}
+
+		virtual bool start() override
+		{
+			return SUCCEEDED(_voice->Start(0));
+		}
+
+		virtual void stop() override
+		{
+			_voice->Stop();
+		}
+
+		virtual void flush() override
+		{
+			_voice->FlushSourceBuffers();
+		}
+
+	private:
+		IXAudio2SourceVoice* _voice;
+		bool _owned;
+	};
+
+	// ʱ֪ͨƵ
+	class StreamCallback :
+		public IXAudio2VoiceCallback
+	{
+	public:
+		StreamCallback()
+			: _stream(nullptr)
+		{
+		}
+
+		// Ҫ֪ͨƵΪ nullptr صٷԭƵ
+		void setStream(easy2d::AudioStream* stream)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stream = stream;
+		}
+
+		STDMETHOD_(void, OnBufferEnd)(void*) override
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_stream)
+			{
+				_stream->notify();
+			}
+		}
+
+		STDMETHOD_(void, OnVoiceProcessingPassStart)(UINT32) override {}
+		STDMETHOD_(void, OnVoiceProcessingPassEnd)() override {}
+		STDMETHOD_(void, OnStreamEnd)() override {}
+		STDMETHOD_(void, OnBufferStart)(void*) override {}
+		STDMETHOD_(void, OnLoopEnd)(void*) override {}
+		STDMETHOD_(void, OnVoiceError)(void*, HRESULT) override {}
+
+	private:
+		std::mutex _mutex;
+		easy2d::AudioStream* _stream;
+	};
+
+	// XAudio2 Ч
+	class XAudio2SoundVoice :
+		public easy2d::SoundVoice
+	{
+	public:
+		explicit XAudio2SoundVoice(IXAudio2SourceVoice* voice)
+			: _voice(voice)
+		{
+		}
+
+		virtual ~XAudio2SoundVoice()
+		{
+			_voice->Stop();
+			_voice->FlushSourceBuffers();
+			_voice->DestroyVoice();
+		}
+
+		virtual bool play(const BYTE * data, UINT32 size, int loopCount) override
+		{
+			stop();
+
+			loopCount = min(loopCount, XAUDIO2_LOOP_INFINITE - 1);
+			loopCount = (loopCount < 0) ? XAUDIO2_LOOP_INFINITE : loopCount;
+
+			XAUDIO2_BUFFER buffer = { 0 };
+			buffer.pAudioData = data;
+			buffer.AudioBytes = size;
+			buffer.Flags = XAUDIO2_END_OF_STREAM;
+			buffer.LoopCount = loopCount;
+
+			return SUCCEEDED(_voice->SubmitSourceBuffer(&buffer))
+				&& SUCCEEDED(_voice->Start(0));
+		}
+
+		virtual void stop() override
+		{
+			if (SUCCEEDED(_voice->Stop()))
+			{
+				_voice->ExitLoop();
+				_voice->FlushSourceBuffers();
+			}
+		}
+
+		virtual bool isPlaying() override
+		{
+			XAUDIO2_VOICE_STATE state;
+			_voice->GetState(&state);
+			return state.BuffersQueued > 0;
+		}
+
+		virtual void setVolume(float volume) override
+		{
+			_voice->SetVolume(volume);
+		}
+
+	private:
+		IXAudio2SourceVoice* _voice;
+	};
+
+	// XAudio2 Ч
+	class XAudio2SoundBackend :
+		public easy2d::SoundBackend
+	{
+	public:
+		virtual easy2d::SoundVoice * createVoice(const WAVEFORMATEX * format) override
+		{
+			if (!s_pXAudio2)
+				return nullptr;
+
+			IXAudio2SourceVoice* voice = nullptr;
+			HRESULT hr = s_pXAudio2->CreateSourceVoice(&voice, format, 0, XAUDIO2_DEFAULT_FREQ_RATIO, nullptr);
+			if (FAILED(hr))
+			{
+				E2D_WARNING(L"Create source voice error (%#X)", hr);
+				return nullptr;
+			}
+			return new (std::nothrow) XAudio2SoundVoice(voice);
+		}
+	};
 }
 
 
@@ -48,9 +342,9 @@ easy2d::Music::Music()
 	: _opened(false)
 	, _playing(false)
 	, _wfx(nullptr)
-	, _waveData(nullptr)
-	, _waveDataSize(0)
 	, _voice(nullptr)
+	, _callback(nullptr)
+	, _stream(nullptr)
 {
 }
 
@@ -85,32 +379,60 @@ bool easy2d::Music::open(const easy2d::String& filePath)
 		return false;
 	}
 
-	String actualFilePath = Path::searchForFile(filePath);
-	if (actualFilePath.empty())
+	if (!s_pXAudio2)
 	{
-		E2D_WARNING(L"MusicInfo::open File not found.");
+		E2D_WARNING(L"IXAudio2 nullptr pointer error!");
 		return false;
 	}
 
-	if (!s_pXAudio2)
+	// ȴѹصԴм
+	HRESULT loadResult = S_OK;
+	Resource::Data data = Package::find(filePath);
+	if (data.isValid())
 	{
-		E2D_WARNING(L"IXAudio2 nullptr pointer error!");
-		return false;
+		loadResult = _loadMediaResource(data.buffer, static_cast<DWORD>(data.size));
+	}
+	else
+	{
+		String actualFilePath = Path::searchForFile(filePath);
+		if (actualFilePath.empty())
+		{
+			E2D_WARNING(L"MusicInfo::open File not found.");
+			return false;
+		}
+
+		// WAV ļֱӳ䵽ڴ棬
+		if (!_wave.open(actualFilePath))
+		{
+			// ϳֱ߽߲
+			loadResult = _openStream(actualFilePath);
+			if (loadResult == S_OK)
+			{
+				_opened = true;
+				_playing = false;
+				return true;
+			}
+
+			if (SUCCEEDED(loadResult))
+			{
+				loadResult = _loadMediaFile(actualFilePath);
+			}
+		}
 	}
 
-	if (FAILED(_loadMediaFile(actualFilePath)))
+	if (FAILED(loadResult))
 	{
 		TraceError(L"Failed to read WAV data");
-		SAFE_DELETE_ARRAY(_waveData);
+		_wave.close();
 		return false;
 	}
 
 	// Դ
 	HRESULT hr;
-	if (FAILED(hr = s_pXAudio2->CreateSourceVoice(&_voice, _wfx, 0, XAUDIO2_DEFAULT_FREQ_RATIO, nullptr)))
+	if (FAILED(hr = s_pXAudio2->CreateSourceVoice(&_voice, _wave.getFormat(), 0, XAUDIO2_DEFAULT_FREQ_RATIO, nullptr)))
 	{
 		TraceError(L"Create source voice error", hr);
-		SAFE_DELETE_ARRAY(_waveData);
+		_wave.close();
 		return false;
 	}
 
@@ -153,16 +475,16 @@ bool easy2d::Music::open(int resNameId, const easy2d::String& resType)
 	if (FAILED(_loadMediaResource(pvRes, dwSize)))
 	{
 		TraceError(L"Failed to read WAV data");
-		SAFE_DELETE_ARRAY(_waveData);
+		_wave.close();
 		return false;
 	}
 
 	// Դ
 	HRESULT hr;
-	if (FAILED(hr = s_pXAudio2->CreateSourceVoice(&_voice, _wfx, 0, XAUDIO2_DEFAULT_FREQ_RATIO, nullptr)))
+	if (FAILED(hr = s_pXAudio2->CreateSourceVoice(&_voice, _wave.getFormat(), 0, XAUDIO2_DEFAULT_FREQ_RATIO, nullptr)))
 	{
 		TraceError(L"Create source voice error", hr);
-		SAFE_DELETE_ARRAY(_waveData);
+		_wave.close();
 		return false;
 	}
 
@@ -185,6 +507,12 @@ bool easy2d::Music::play(int nLoopCount)
 		return false;
 	}
 
+	if (_stream)
+	{
+		_playing = _stream->play(nLoopCount);
+		return _playing;
+	}
+
 	if (_playing)
 	{
 		stop();
@@ -195,9 +523,9 @@ bool easy2d::Music::play(int nLoopCount)
 
 	// ύ wave 
 	XAUDIO2_BUFFER buffer = { 0 };
-	buffer.pAudioData = _waveData;
+	buffer.pAudioData = _wave.getData();
 	buffer.Flags = XAUDIO2_END_OF_STREAM;
-	buffer.AudioBytes = _waveDataSize;
+	buffer.AudioBytes = _wave.getDataSize();
 	buffer.LoopCount = nLoopCount;
 
 	HRESULT hr;
@@ -205,7 +533,7 @@ bool easy2d::Music::play(int nLoopCount)
 	{
 		TraceError(L"Submitting source buffer error", hr);
 		_voice->DestroyVoice();
-		SAFE_DELETE_ARRAY(_waveData);
+		_wave.close();
 		return false;
 	}
 
@@ -220,7 +548,12 @@ bool easy2d::Music::play(int nLoopCount)
 
 void easy2d::Music::pause()
 {
-	if (_voice)
+	if (_stream)
+	{
+		_stream->pause();
+		_playing = false;
+	}
+	else if (_voice)
 	{
 		if (SUCCEEDED(_voice->Stop()))
 		{
@@ -231,7 +564,12 @@ void easy2d::Music::pause()
 
 void easy2d::Music::resume()
 {
-	if (_voice)
+	if (_stream)
+	{
+		_stream->resume();
+		_playing = _stream->isPlaying();
+	}
+	else if (_voice)
 	{
 		if (SUCCEEDED(_voice->Start()))
 		{
@@ -242,7 +580,12 @@ void easy2d::Music::resume()
 
 void easy2d::Music::stop()
 {
-	if (_voice)
+	if (_stream)
+	{
+		_stream->stop();
+		_playing = false;
+	}
+	else if (_voice)
 	{
 		if (SUCCEEDED(_voice->Stop()))
 		{
@@ -255,6 +598,19 @@ void easy2d::Music::stop()
 
 void easy2d::Music::close()
 {
+	// ȶϿصƵϵ֮ջĻصٷƵ
+	// ٽƵḷ̨́߳Դ
+	if (_callback)
+	{
+		static_cast<StreamCallback*>(_callback)->setStream(nullptr);
+	}
+
+	if (_stream)
+	{
+		delete _stream;
+		_stream = nullptr;
+	}
+
 	if (_voice)
 	{
 		_voice->Stop();
@@ -263,13 +619,19 @@ void easy2d::Music::close()
 		_voice = nullptr;
 	}
 
+	if (_callback)
+	{
+		delete static_cast<StreamCallback*>(_callback);
+		_callback = nullptr;
+	}
+
 	if (_wfx)
 	{
 		::CoTaskMemFree(_wfx);
 		_wfx = nullptr;
 	}
 
-	SAFE_DELETE_ARRAY(_waveData);
+	_wave.close();
 
 	_opened = false;
 	_playing = false;
@@ -277,7 +639,12 @@ void easy2d::Music::close()
 
 bool easy2d::Music::isPlaying() const
 {
-	if (_opened && _voice)
+	if (_opened && _stream)
+	{
+		_playing = _stream->isPlaying();
+		return _playing;
+	}
+	else if (_opened && _voice)
 	{
 		XAUDIO2_VOICE_STATE state;
 		_voice->GetState(&state);
@@ -294,6 +661,25 @@ bool easy2d::Music::isPlaying() const
 	}
 }
 
+bool easy2d::Music::isPaused() const
+{
+	if (_opened && _stream)
+	{
+		return _stream->isPaused();
+	}
+	else if (_opened && _voice && !_playing)
+	{
+		// ͣʱԴֹͣڶУֹͣʱջ
+		XAUDIO2_VOICE_STATE state;
+		_voice->GetState(&state);
+		return state.BuffersQueued > 0;
+	}
+	else
+	{
+		return false;
+	}
+}
+
 bool easy2d::Music::setVolume(float volume)
 {
 	if (_voice)
@@ -303,6 +689,105 @@ bool easy2d::Music::setVolume(float volume)
 	return false;
 }
 
+bool easy2d::Music::isStreaming() const
+{
+	return _stream != nullptr;
+}
+
+size_t easy2d::Music::getMemoryUsage() const
+{
+	if (_stream)
+		return _stream->getMemoryUsage();
+	return _wave.getDataSize();
+}
+
+void easy2d::Music::setStreamingThreshold(float seconds)
+{
+	s_fStreamingThreshold = seconds;
+}
+
+HRESULT easy2d::Music::_openStream(String const& file_path)
+{
+	if (s_fStreamingThreshold < 0)
+		return S_FALSE;
+
+	HRESULT hr = S_OK;
+	IMFSourceReader* reader = nullptr;
+
+	hr = MFCreateSourceReaderFromURL(
+		file_path.c_str(),
+		nullptr,
+		&reader
+	);
+
+	if (SUCCEEDED(hr))
+	{
+		// ʱδֵʱ
+		LONGLONG duration = GetDuration(reader);
+		if (duration <= static_cast<LONGLONG>(s_fStreamingThreshold * 10000000))
+		{
+			SafeRelease(reader);
+			return S_FALSE;
+		}
+
+		hr = _initSource(reader);
+	}
+
+	StreamCallback* callback = nullptr;
+	if (SUCCEEDED(hr))
+	{
+		callback = new (std::nothrow) StreamCallback;
+		hr = callback ? S_OK : E_OUTOFMEMORY;
+	}
+
+	if (SUCCEEDED(hr))
+	{
+		hr = s_pXAudio2->CreateSourceVoice(&_voice, _wfx, 0, XAUDIO2_DEFAULT_FREQ_RATIO, callback);
+	}
+
+	if (SUCCEEDED(hr))
+	{
+		// ÿԼ 0.25 룬
+		UINT32 bufferSize = max(_wfx->nAvgBytesPerSec / 4, 4096U);
+		bufferSize -= bufferSize % max(_wfx->nBlockAlign, 1);
+
+		_stream = new (std::nothrow) AudioStream(
+			new MediaDecoder(reader),
+			new VoiceOutput(_voice),
+			bufferSize,
+			3
+		);
+
+		if (_stream)
+		{
+			_callback = callback;
+			callback->setStream(_stream);
+		}
+		else
+		{
+			hr = E_OUTOFMEMORY;
+		}
+	}
+
+	if (FAILED(hr))
+	{
+		if (_voice)
+		{
+			_voice->DestroyVoice();
+			_voice = nullptr;
+		}
+		if (_wfx)
+		{
+			::CoTaskMemFree(_wfx);
+			_wfx = nullptr;
+		}
+		delete callback;
+	}
+
+	SafeRelease(reader);
+	return hr;
+}
+
 HRESULT easy2d::Music::_loadMediaFile(String const& file_path)
 {
 	HRESULT hr = S_OK;
@@ -326,6 +811,10 @@ HRESULT easy2d::Music::_loadMediaFile(String const& file_path)
 
 HRESULT easy2d::Music::_loadMediaResource(LPVOID buffer, DWORD bufferSize)
 {
+	// WAV ֱԴڴ棬
+	if (_wave.parse(buffer, bufferSize))
+		return S_OK;
+
 	HRESULT	hr = S_OK;
 
 	IStream* stream = nullptr;
@@ -370,81 +859,16 @@ HRESULT easy2d::Music::_loadMediaResource(LPVOID buffer, DWORD bufferSize)
 
 HRESULT easy2d::Music::_readSource(IMFSourceReader* reader)
 {
-	HRESULT hr = S_OK;
+	HRESULT hr = _initSource(reader);
 	DWORD max_stream_size = 0;
 
-	IMFMediaType* partial_type = nullptr;
-	IMFMediaType* uncompressed_type = nullptr;
-
-	hr = MFCreateMediaType(&partial_type);
-
-	if (SUCCEEDED(hr))
-	{
-		hr = partial_type->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Audio);
-	}
-
-	if (SUCCEEDED(hr))
-	{
-		hr = partial_type->SetGUID(MF_MT_SUBTYPE, MFAudioFormat_PCM);
-	}
-
-	//  source reader ýͣʹúʵĽȥƵ
-	if (SUCCEEDED(hr))
-	{
-		hr = reader->SetCurrentMediaType(
-			(DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
-			0,
-			partial_type
-		);
-	}
-
-	//  IMFMediaType лȡ WAVEFORMAT ṹ
-	if (SUCCEEDED(hr))
-	{
-		hr = reader->GetCurrentMediaType(
-			(DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
-			&uncompressed_type
-		);
-	}
-
-	// ָƵ
-	if (SUCCEEDED(hr))
-	{
-		hr = reader->SetStreamSelection(
-			(DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
-			true
-		);
-	}
-
-	// ȡ WAVEFORMAT 
-	if (SUCCEEDED(hr))
-	{
-		UINT32 size = 0;
-		hr = MFCreateWaveFormatExFromMFMediaType(
-			uncompressed_type,
-			&_wfx,
-			&size,
-			(DWORD)MFWaveFormatExConvertFlag_Normal
-		);
-	}
-
 	// ƵС
 	if (SUCCEEDED(hr))
 	{
-		PROPVARIANT prop;
-		PropVariantInit(&prop);
-
-		hr = reader->GetPresentationAttribute(
-			(DWORD)MF_SOURCE_READER_MEDIASOURCE,
-			MF_PD_DURATION,
-			&prop
-		);
-
-		LONGLONG duration = prop.uhVal.QuadPart;
+		LONGLONG duration = GetDuration(reader);
 		max_stream_size = static_cast<DWORD>(
 			(duration * _wfx->nAvgBytesPerSec) / 10000000 + 1
 			);
-		PropVariantClear(&prop);
 	}
 
 	// ȡƵ
@@ -512,8 +936,11 @@ HRESULT easy2d::Music::_readSource(IMFSourceReader* reader)
 
 			if (SUCCEEDED(hr))
 			{
-				_waveData = data;
-				_waveDataSize = position;
+				_wave._assign(data, position, _wfx);
+
+				// ʽѸƵ
+				::CoTaskMemFree(_wfx);
+				_wfx = nullptr;
 			}
 			else
 			{
@@ -526,6 +953,68 @@ HRESULT easy2d::Music::_readSource(IMFSourceReader* reader)
 		SafeRelease(buffer);
 	}
 
+	return hr;
+}
+
+HRESULT easy2d::Music::_initSource(IMFSourceReader* reader)
+{
+	HRESULT hr = S_OK;
+
+	IMFMediaType* partial_type = nullptr;
+	IMFMediaType* uncompressed_type = nullptr;
+
+	hr = MFCreateMediaType(&partial_type);
+
+	if (SUCCEEDED(hr))
+	{
+		hr = partial_type->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Audio);
+	}
+
+	if (SUCCEEDED(hr))
+	{
+		hr = partial_type->SetGUID(MF_MT_SUBTYPE, MFAudioFormat_PCM);
+	}
+
+	//  source reader ýͣʹúʵĽȥƵ
+	if (SUCCEEDED(hr))
+	{
+		hr = reader->SetCurrentMediaType(
+			(DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
+			0,
+			partial_type
+		);
+	}
+
+	//  IMFMediaType лȡ WAVEFORMAT ṹ
+	if (SUCCEEDED(hr))
+	{
+		hr = reader->GetCurrentMediaType(
+			(DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
+			&uncompressed_type
+		);
+	}
+
+	// ָƵ
+	if (SUCCEEDED(hr))
+	{
+		hr = reader->SetStreamSelection(
+			(DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
+			true
+		);
+	}
+
+	// ȡ WAVEFORMAT 
+	if (SUCCEEDED(hr))
+	{
+		UINT32 size = 0;
+		hr = MFCreateWaveFormatExFromMFMediaType(
+			uncompressed_type,
+			&_wfx,
+			&size,
+			(DWORD)MFWaveFormatExConvertFlag_Normal
+		);
+	}
+
 	SafeRelease(partial_type);
 	SafeRelease(uncompressed_type);
 	return hr;
@@ -557,6 +1046,105 @@ bool easy2d::Music::__init()
 	return true;
 }
 
+bool easy2d::Music::__decode(const String& filePath, WaveFile& wave)
+{
+	if (!s_pXAudio2)
+	{
+		E2D_WARNING(L"IXAudio2 nullptr pointer error!");
+		return false;
+	}
+
+	Music decoder;
+
+	HRESULT hr = S_OK;
+	Resource::Data res = Package::find(filePath);
+	if (res.isValid())
+	{
+		hr = decoder._loadMediaResource(res.buffer, static_cast<DWORD>(res.size));
+	}
+	else
+	{
+		String actualFilePath = Path::searchForFile(filePath);
+		if (actualFilePath.empty())
+		{
+			E2D_WARNING(L"Sound::open File not found.");
+			return false;
+		}
+
+		if (!decoder._wave.open(actualFilePath))
+		{
+			hr = decoder._loadMediaFile(actualFilePath);
+		}
+	}
+
+	if (FAILED(hr))
+	{
+		TraceError(L"Failed to read WAV data", hr);
+		return false;
+	}
+
+	wave._swap(decoder._wave);
+	return true;
+}
+
+bool easy2d::Music::__decode(int resNameId, const String& resType, WaveFile& wave)
+{
+	HRSRC hResInfo;
+	HGLOBAL hResData;
+	DWORD dwSize;
+	void* pvRes;
+
+	if (!s_pXAudio2)
+	{
+		E2D_WARNING(L"IXAudio2 nullptr pointer error!");
+		return false;
+	}
+
+	if (nullptr == (hResInfo = FindResourceW(HINST_THISCOMPONENT, MAKEINTRESOURCE(resNameId), resType.c_str())))
+		return TraceError(L"FindResource");
+
+	if (nullptr == (hResData = LoadResource(HINST_THISCOMPONENT, hResInfo)))
+		return TraceError(L"LoadResource");
+
+	if (0 == (dwSize = SizeofResource(HINST_THISCOMPONENT, hResInfo)))
+		return TraceError(L"SizeofResource");
+
+	if (nullptr == (pvRes = LockResource(hResData)))
+		return TraceError(L"LockResource");
+
+	Music decoder;
+
+	HRESULT hr = decoder._loadMediaResource(pvRes, dwSize);
+	if (FAILED(hr))
+	{
+		TraceError(L"Failed to read WAV data", hr);
+		return false;
+	}
+
+	wave._swap(decoder._wave);
+	return true;
+}
+
+easy2d::SoundBackend * easy2d::Music::__createSoundBackend()
+{
+	return new (std::nothrow) XAudio2SoundBackend;
+}
+
+easy2d::AudioOutput * easy2d::Music::__createAudioOutput(const WAVEFORMATEX * format)
+{
+	if (!s_pXAudio2)
+		return nullptr;
+
+	IXAudio2SourceVoice* voice = nullptr;
+	HRESULT hr = s_pXAudio2->CreateSourceVoice(&voice, format, 0, XAUDIO2_DEFAULT_FREQ_RATIO, nullptr);
+	if (FAILED(hr))
+	{
+		TraceError(L"Create source voice error", hr);
+		return nullptr;
+	}
+	return new (std::nothrow) VoiceOutput(voice, true);
+}
+
 void easy2d::Music::__uninit()
 {
 	if (s_pMasteringVoice)
@@ -720,6 +1308,66 @@ bool easy2d::Music::isPlaying() const
 	return _playing;
 }
 
+bool easy2d::Music::isPaused() const
+{
+	if (!_dev)
+		return false;
+
+	MCI_STATUS_PARMS mciStatus = { 0 };
+	mciStatus.dwItem = MCI_STATUS_MODE;
+
+	MCIERROR mciError = mciSendCommand(
+		_dev,
+		MCI_STATUS,
+		MCI_STATUS_ITEM,
+		reinterpret_cast<DWORD_PTR>(&mciStatus)
+	);
+
+	return !mciError && mciStatus.dwReturn == MCI_MODE_PAUSE;
+}
+
+bool easy2d::Music::isStreaming() const
+{
+	// MCI жȡļ
+	return false;
+}
+
+size_t easy2d::Music::getMemoryUsage() const
+{
+	return 0;
+}
+
+bool easy2d::Music::__decode(const String& filePath, WaveFile& wave)
+{
+	// NOT SUPPORTED
+	E2D_WARNING(L"Sound is not supported with MCI");
+	return false;
+}
+
+bool easy2d::Music::__decode(int resNameId, const String& resType, WaveFile& wave)
+{
+	// NOT SUPPORTED
+	E2D_WARNING(L"Sound is not supported with MCI");
+	return false;
+}
+
+easy2d::SoundBackend * easy2d::Music::__createSoundBackend()
+{
+	// NOT SUPPORTED
+	return nullptr;
+}
+
+easy2d::AudioOutput * easy2d::Music::__createAudioOutput(const WAVEFORMATEX * format)
+{
+	// NOT SUPPORTED
+	return nullptr;
+}
+
+void easy2d::Music::setStreamingThreshold(float seconds)
+{
+	// NOT SUPPORTED
+}
+
 bool easy2d::Music::setVolume(float volume)
 {
 	// NOT SUPPORTED
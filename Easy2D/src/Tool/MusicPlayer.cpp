@@ -1,8 +1,21 @@
 #include <easy2d/e2dtool.h>
 #include <map>
+#include <list>
+#include <unordered_map>
 
 typedef std::map<size_t, easy2d::Music *> MusicMap;
 
+// ڵ㣬ʹʱУʹõĩβ
+struct MusicCacheNode
+{
+	bool resource;
+	size_t key;
+	easy2d::Music * music;
+	size_t bytes;
+};
+
+typedef std::list<MusicCacheNode> MusicCacheList;
+
 static MusicMap& GetMusicFileList()
 {
 	static MusicMap s_MusicFileList;
@@ -15,7 +28,47 @@ static MusicMap& GetMusicResList()
 	return s_MusicResList;
 }
 
+static MusicCacheList& GetMusicCacheList()
+{
+	static MusicCacheList s_MusicCacheList;
+	return s_MusicCacheList;
+}
+
+static std::unordered_map<easy2d::Music *, MusicCacheList::iterator>& GetMusicCacheIndex()
+{
+	static std::unordered_map<easy2d::Music *, MusicCacheList::iterator> s_MusicCacheIndex;
+	return s_MusicCacheIndex;
+}
+
 static float s_fMusicVolume = 1.0;
+static size_t s_nCacheBudget = 64 * 1024 * 1024;
+static size_t s_nCacheBytes = 0;
+static easy2d::MusicPlayer::CacheStats s_CacheStats = { 0 };
+
+// ¼¼ص
+static void AddToCache(bool resource, size_t key, easy2d::Music * music)
+{
+	MusicCacheNode node = { resource, key, music, music->getMemoryUsage() };
+	s_nCacheBytes += node.bytes;
+
+	auto& list = GetMusicCacheList();
+	GetMusicCacheIndex()[music] = list.insert(list.end(), node);
+	++s_CacheStats.misses;
+
+	easy2d::MusicPlayer::trimCache();
+}
+
+// Ƶʹõλ
+static void TouchCache(easy2d::Music * music)
+{
+	auto iter = GetMusicCacheIndex().find(music);
+	if (iter != GetMusicCacheIndex().end())
+	{
+		auto& list = GetMusicCacheList();
+		list.splice(list.end(), list, iter->second);
+	}
+	++s_CacheStats.hits;
+}
 
 
 easy2d::Music* easy2d::MusicPlayer::preload(const String& filePath)
@@ -25,6 +78,7 @@ easy2d::Music* easy2d::MusicPlayer::preload(const String& filePath)
 	auto iter = GetMusicFileList().find(hash);
 	if (GetMusicFileList().end() != iter)
 	{
+		TouchCache(iter->second);
 		return iter->second;
 	}
 	
@@ -36,6 +90,7 @@ easy2d::Music* easy2d::MusicPlayer::preload(const String& filePath)
 
 		music->setVolume(s_fMusicVolume);
 		GetMusicFileList().insert(std::pair<size_t, Music*>(hash, music));
+		AddToCache(false, hash, music);
 		return music;
 	}
 	return nullptr;
@@ -106,6 +161,7 @@ easy2d::Music* easy2d::MusicPlayer::preload(int resNameId, const String& resType
 	auto iter = GetMusicResList().find(resNameId);
 	if (GetMusicResList().end() != iter)
 	{
+		TouchCache(iter->second);
 		return iter->second;
 	}
 	
@@ -117,6 +173,7 @@ easy2d::Music* easy2d::MusicPlayer::preload(int resNameId, const String& resType
 
 		music->setVolume(s_fMusicVolume);
 		GetMusicResList().insert(std::pair<size_t, Music*>(resNameId, music));
+		AddToCache(true, resNameId, music);
 		return music;
 	}
 	return nullptr;
@@ -198,6 +255,59 @@ void easy2d::MusicPlayer::stopAll()
 	}
 }
 
+void easy2d::MusicPlayer::setCacheBudget(size_t bytes)
+{
+	s_nCacheBudget = bytes;
+	MusicPlayer::trimCache();
+}
+
+void easy2d::MusicPlayer::trimCache()
+{
+	if (s_nCacheBudget == 0)
+		return;
+
+	auto& list = GetMusicCacheList();
+	for (auto iter = list.begin(); iter != list.end() && s_nCacheBytes > s_nCacheBudget;)
+	{
+		// ֻսûڲŵֻ֣ͣպ޷
+		Music * music = iter->music;
+		if (music->getRefCount() > 1 || music->isPlaying() || music->isPaused())
+		{
+			++iter;
+			continue;
+		}
+
+		if (iter->resource)
+			GetMusicResList().erase(iter->key);
+		else
+			GetMusicFileList().erase(iter->key);
+
+		s_nCacheBytes -= iter->bytes;
+		GetMusicCacheIndex().erase(music);
+		iter = list.erase(iter);
+		++s_CacheStats.evictions;
+
+		music->close();
+		GC::release(music);
+	}
+}
+
+easy2d::MusicPlayer::CacheStats easy2d::MusicPlayer::getCacheStats()
+{
+	CacheStats stats = s_CacheStats;
+	stats.count = static_cast<UINT32>(GetMusicCacheList().size());
+	stats.bytes = s_nCacheBytes;
+	stats.budget = s_nCacheBudget;
+	return stats;
+}
+
+void easy2d::MusicPlayer::resetCacheStats()
+{
+	s_CacheStats.hits = 0;
+	s_CacheStats.misses = 0;
+	s_CacheStats.evictions = 0;
+}
+
 void easy2d::MusicPlayer::__uninit()
 {
 	for (auto pair : GetMusicFileList())
@@ -214,4 +324,7 @@ void easy2d::MusicPlayer::__uninit()
 
 	GetMusicFileList().clear();
 	GetMusicResList().clear();
+	GetMusicCacheList().clear();
+	GetMusicCacheIndex().clear();
+	s_nCacheBytes = 0;
 }
@@ -0,0 +1,656 @@
+#include <easy2d/e2dtool.h>
+#include <algorithm>
+#include <climits>
+#include <fstream>
+
+namespace
+{
+	// Դʽ
+	// [PackHeader][ݿ飨16 ֽڶ룩...][PackEntry ϣ][ļUTF-16]
+	const char		PACK_MAGIC[4] = { 'E', '2', 'P', 'K' };
+	const UINT32	PACK_VERSION = 1;
+	const UINT64	PACK_ALIGNMENT = 16;
+	const UINT16	PACK_FLAG_COMPRESSED = 0x1;
+	// LZ4 ÿֽ໹ԭ 255 ֽ
+	const UINT64	PACK_MAX_RATIO = 255;
+
+#pragma pack(push, 1)
+	struct PackHeader
+	{
+		char	magic[4];
+		UINT32	version;
+		UINT32	count;
+		UINT32	reserved;
+		UINT64	indexOffset;
+		UINT64	namesOffset;
+	};
+
+	struct PackEntry
+	{
+		UINT64	hash;
+		UINT64	offset;
+		UINT32	size;		// ԭʼС
+		UINT32	storedSize;	// ڴС
+		UINT32	nameOffset;	// ļļеλãַ
+		UINT16	nameLength;
+		UINT16	flags;
+	};
+#pragma pack(pop)
+
+
+	// ͳһļʽСдʹ '/' ָȥͷ "./"  '/'
+	easy2d::String NormalizeName(const easy2d::String& name)
+	{
+		easy2d::String result = name;
+		std::transform(result.begin(), result.end(), result.begin(), [](wchar_t ch)
+		{
+			return ch == L'\\' ? L'/' : static_cast<wchar_t>(::towlower(ch));
+		});
+
+		size_t start = 0;
+		while (start < result.size())
+		{
+			if (result[start] == L'/')
+				++start;
+			else if (result.compare(start, 2, L"./") == 0)
+				start += 2;
+			else
+				break;
+		}
+		return result.substr(start);
+	}
+
+	// FNV-1a 64 λϣƽ̨޹أдļ
+	UINT64 HashName(const easy2d::String& name)
+	{
+		UINT64 hash = 14695981039346656037ULL;
+		for (auto ch : name)
+		{
+			UINT16 unit = static_cast<UINT16>(ch);
+			hash = (hash ^ (unit & 0xFF)) * 1099511628211ULL;
+			hash = (hash ^ (unit >> 8)) * 1099511628211ULL;
+		}
+		return hash;
+	}
+
+
+	// LZ4 ʽѹ̰ƥ䣩ѹʱ false
+	bool Compress(const BYTE* src, size_t size, std::vector<BYTE>& dst)
+	{
+		const size_t MIN_MATCH = 4;
+		const size_t LAST_LITERALS = 5;
+		const size_t MF_LIMIT = 12;
+		const int HASH_BITS = 12;
+
+		dst.clear();
+		dst.reserve(size);
+
+		auto read32 = [src](size_t pos) -> UINT32
+		{
+			UINT32 value;
+			memcpy(&value, src + pos, sizeof(value));
+			return value;
+		};
+
+		auto writeLength = [&dst](size_t length)
+		{
+			while (length >= 255)
+			{
+				dst.push_back(255);
+				length -= 255;
+			}
+			dst.push_back(static_cast<BYTE>(length));
+		};
+
+		auto emit = [&](size_t anchor, size_t literals, size_t offset, size_t matchLength)
+		{
+			BYTE token = static_cast<BYTE>(min(literals, 15) << 4);
+			if (matchLength)
+			{
+				token |= static_cast<BYTE>(min(matchLength - MIN_MATCH, 15));
+			}
+			dst.push_back(token);
+
+			if (literals >= 15)
+				writeLength(literals - 15);
+			dst.insert(dst.end(), src + anchor, src + anchor + literals);
+
+			if (matchLength)
+			{
+				dst.push_back(static_cast<BYTE>(offset & 0xFF));
+				dst.push_back(static_cast<BYTE>(offset >> 8));
+				if (matchLength - MIN_MATCH >= 15)
+					writeLength(matchLength - MIN_MATCH - 15);
+			}
+		};
+
+		size_t anchor = 0;
+		if (size > MF_LIMIT)
+		{
+			std::vector<int> table(1 << HASH_BITS, -1);
+			const size_t limit = size - MF_LIMIT;
+			const size_t matchLimit = size - LAST_LITERALS;
+			size_t pos = 0;
+
+			while (pos < limit)
+			{
+				UINT32 sequence = read32(pos);
+				UINT32 hash = (sequence * 2654435761U) >> (32 - HASH_BITS);
+				int ref = table[hash];
+				table[hash] = static_cast<int>(pos);
+
+				if (ref >= 0 && pos - ref <= 0xFFFF && read32(ref) == sequence)
+				{
+					size_t length = MIN_MATCH;
+					while (pos + length < matchLimit && src[ref + length] == src[pos + length])
+					{
+						++length;
+					}
+
+					emit(anchor, pos - anchor, pos - ref, length);
+					pos += length;
+					anchor = pos;
+
+					if (dst.size() >= size)
+						return false;
+				}
+				else
+				{
+					++pos;
+				}
+			}
+		}
+
+		emit(anchor, size - anchor, 0, 0);
+		return dst.size() < size;
+	}
+
+	// LZ4 ʽѹ
+	bool Decompress(const BYTE* src, size_t srcSize, BYTE* dst, size_t dstSize)
+	{
+		const BYTE* ip = src;
+		const BYTE* const srcEnd = src + srcSize;
+		BYTE* op = dst;
+		BYTE* const dstEnd = dst + dstSize;
+
+		auto readLength = [&](size_t& length) -> bool
+		{
+			BYTE b;
+			do
+			{
+				if (ip >= srcEnd)
+					return false;
+				b = *ip++;
+				length += b;
+			} while (b == 255);
+			return true;
+		};
+
+		while (ip < srcEnd)
+		{
+			BYTE token = *ip++;
+
+			size_t literals = token >> 4;
+			if (literals == 15 && !readLength(literals))
+				return false;
+
+			if (literals > static_cast<size_t>(srcEnd - ip) || literals > static_cast<size_t>(dstEnd - op))
+				return false;
+
+			memcpy(op, ip, literals);
+			ip += literals;
+			op += literals;
+
+			// һֻ
+			if (ip == srcEnd)
+				break;
+
+			if (srcEnd - ip < 2)
+				return false;
+
+			size_t offset = ip[0] | (ip[1] << 8);
+			ip += 2;
+			if (offset == 0 || offset > static_cast<size_t>(op - dst))
+				return false;
+
+			size_t length = token & 0x0F;
+			if (length == 15 && !readLength(length))
+				return false;
+			length += 4;
+
+			if (length > static_cast<size_t>(dstEnd - op))
+				return false;
+
+			// ƥصֽڸ
+			const BYTE* match = op - offset;
+			for (size_t i = 0; i < length; ++i)
+			{
+				op[i] = match[i];
+			}
+			op += length;
+		}
+
+		return op == dstEnd;
+	}
+
+
+	// ѹصԴ
+	struct MountedPackage
+	{
+		HANDLE				file;
+		HANDLE				mapping;
+		const BYTE *		base;
+		UINT64				size;
+		const PackEntry *	entries;
+		UINT32				count;
+		const wchar_t *		names;
+		UINT64				namesLength;
+		// ѹļ״ηʱѹ浽Դж
+		std::vector<std::vector<BYTE>> decoded;
+		// retain ӵ
+		int					refCount;
+	};
+
+	std::vector<MountedPackage*> s_vPackages;
+	// жصԱõԴһͷʱӳ
+	std::vector<MountedPackage*> s_vRetired;
+
+
+	void Unmount(MountedPackage * package)
+	{
+		if (package->base)
+			::UnmapViewOfFile(package->base);
+		if (package->mapping)
+			::CloseHandle(package->mapping);
+		if (package->file != INVALID_HANDLE_VALUE)
+			::CloseHandle(package->file);
+		delete package;
+	}
+
+	// жϵַǷԴӳѹ
+	bool ContainsAddress(const MountedPackage * package, const void * buffer)
+	{
+		const BYTE * p = static_cast<const BYTE*>(buffer);
+		if (package->base && p >= package->base && p < package->base + package->size)
+			return true;
+
+		for (const auto& decoded : package->decoded)
+		{
+			if (!decoded.empty() && p >= decoded.data() && p < decoded.data() + decoded.size())
+				return true;
+		}
+		return false;
+	}
+
+	// Դвļλ
+	const PackEntry * FindEntry(const MountedPackage * package, UINT64 hash, const easy2d::String& name)
+	{
+		const PackEntry * begin = package->entries;
+		const PackEntry * end = package->entries + package->count;
+		const PackEntry * iter = std::lower_bound(begin, end, hash, [](const PackEntry& entry, UINT64 h)
+		{
+			return entry.hash < h;
+		});
+
+		// ϣͬʱȽļ
+		for (; iter != end && iter->hash == hash; ++iter)
+		{
+			if (iter->nameLength == name.size() &&
+				static_cast<UINT64>(iter->nameOffset) + iter->nameLength <= package->namesLength &&
+				name.compare(0, name.size(), package->names + iter->nameOffset, iter->nameLength) == 0)
+			{
+				return iter;
+			}
+		}
+		return nullptr;
+	}
+
+	// ݹռļеļ
+	void CollectFiles(const easy2d::String& root, const easy2d::String& relative, std::vector<easy2d::String>& files)
+	{
+		WIN32_FIND_DATAW findData;
+		HANDLE hFind = ::FindFirstFileW((root + relative + L"*").c_str(), &findData);
+		if (hFind == INVALID_HANDLE_VALUE)
+			return;
+
+		do
+		{
+			easy2d::String name = findData.cFileName;
+			if (name == L"." || name == L"..")
+				continue;
+
+			if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			{
+				CollectFiles(root, relative + name + L"\\", files);
+			}
+			else
+			{
+				files.push_back(relative + name);
+			}
+		} while (::FindNextFileW(hFind, &findData));
+
+		::FindClose(hFind);
+	}
+}
+
+
+bool easy2d::Package::mount(const String& filePath)
+{
+	String actualFilePath = Path::searchForFile(filePath);
+	if (actualFilePath.empty())
+	{
+		E2D_WARNING(L"Package::mount failed! File not found.");
+		return false;
+	}
+
+	auto package = new (std::nothrow) MountedPackage();
+	if (!package)
+		return false;
+
+	package->refCount = 0;
+	package->file = ::CreateFileW(actualFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	LARGE_INTEGER fileSize = { 0 };
+	bool succeeded = (package->file != INVALID_HANDLE_VALUE) && ::GetFileSizeEx(package->file, &fileSize);
+
+	if (succeeded)
+	{
+		package->mapping = ::CreateFileMappingW(package->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		succeeded = (package->mapping != nullptr);
+	}
+
+	if (succeeded)
+	{
+		package->base = static_cast<const BYTE*>(::MapViewOfFile(package->mapping, FILE_MAP_READ, 0, 0, 0));
+		package->size = static_cast<UINT64>(fileSize.QuadPart);
+		succeeded = (package->base != nullptr);
+	}
+
+	// УļͷΧ
+	if (succeeded)
+	{
+		const PackHeader * header = reinterpret_cast<const PackHeader*>(package->base);
+		succeeded = package->size >= sizeof(PackHeader) &&
+			memcmp(header->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) == 0 &&
+			header->version == PACK_VERSION &&
+			header->indexOffset <= header->namesOffset &&
+			static_cast<UINT64>(header->count) * sizeof(PackEntry) <= header->namesOffset - header->indexOffset &&
+			header->namesOffset <= package->size;
+
+		if (succeeded)
+		{
+			package->entries = reinterpret_cast<const PackEntry*>(package->base + header->indexOffset);
+			package->count = header->count;
+			package->names = reinterpret_cast<const wchar_t*>(package->base + header->namesOffset);
+			package->namesLength = (package->size - header->namesOffset) / sizeof(wchar_t);
+			package->decoded.resize(header->count);
+
+			for (UINT32 i = 0; i < package->count && succeeded; ++i)
+			{
+				const PackEntry& entry = package->entries[i];
+				// ֿȽϣƫʱ
+				succeeded = entry.offset <= header->indexOffset && entry.storedSize <= header->indexOffset - entry.offset;
+
+				// ԴݵĴС int ʾδѹļֱӷӳеݣԭʼСڴСһ£
+				// ѹļѹǰԭʼСڴ棬ԭʼСܳѹʽܻԭĴС
+				if (succeeded && entry.size > static_cast<UINT32>(INT_MAX))
+					succeeded = false;
+				else if (succeeded && (entry.flags & PACK_FLAG_COMPRESSED))
+					succeeded = entry.storedSize < entry.size && entry.size <= entry.storedSize * PACK_MAX_RATIO;
+				else if (succeeded)
+					succeeded = entry.size == entry.storedSize;
+			}
+		}
+	}
+
+	if (!succeeded)
+	{
+		E2D_WARNING(L"Package::mount failed! Invalid package file.");
+		Unmount(package);
+		return false;
+	}
+
+	s_vPackages.push_back(package);
+	return true;
+}
+
+void easy2d::Package::unmountAll()
+{
+	for (auto package : s_vPackages)
+	{
+		if (package->refCount > 0)
+		{
+			// ƵֱӳеݣƳٵȫͷźٽӳ
+			s_vRetired.push_back(package);
+		}
+		else
+		{
+			Unmount(package);
+		}
+	}
+	s_vPackages.clear();
+}
+
+bool easy2d::Package::retain(const void* buffer)
+{
+	if (buffer == nullptr)
+		return false;
+
+	for (auto package : s_vPackages)
+	{
+		if (ContainsAddress(package, buffer))
+		{
+			++package->refCount;
+			return true;
+		}
+	}
+	return false;
+}
+
+void easy2d::Package::release(const void* buffer)
+{
+	if (buffer == nullptr)
+		return;
+
+	for (auto package : s_vPackages)
+	{
+		if (ContainsAddress(package, buffer))
+		{
+			if (package->refCount > 0)
+				--package->refCount;
+			return;
+		}
+	}
+
+	for (auto iter = s_vRetired.begin(); iter != s_vRetired.end(); ++iter)
+	{
+		MountedPackage * package = *iter;
+		if (ContainsAddress(package, buffer))
+		{
+			if (--package->refCount <= 0)
+			{
+				Unmount(package);
+				s_vRetired.erase(iter);
+			}
+			return;
+		}
+	}
+}
+
+bool easy2d::Package::contains(const String& fileName)
+{
+	if (s_vPackages.empty())
+		return false;
+
+	String name = NormalizeName(fileName);
+	UINT64 hash = HashName(name);
+
+	for (auto package : s_vPackages)
+	{
+		if (FindEntry(package, hash, name))
+			return true;
+	}
+	return false;
+}
+
+easy2d::Resource::Data easy2d::Package::find(const String& fileName)
+{
+	Resource::Data data;
+	if (s_vPackages.empty())
+		return data;
+
+	String name = NormalizeName(fileName);
+	UINT64 hash = HashName(name);
+
+	// صԴȣòļ
+	for (auto iter = s_vPackages.rbegin(); iter != s_vPackages.rend(); ++iter)
+	{
+		MountedPackage * package = *iter;
+		const PackEntry * entry = FindEntry(package, hash, name);
+		if (!entry)
+			continue;
+
+		if (!(entry->flags & PACK_FLAG_COMPRESSED))
+		{
+			data.buffer = const_cast<BYTE*>(package->base + entry->offset);
+			data.size = static_cast<int>(entry->size);
+			return data;
+		}
+
+		auto& buffer = package->decoded[entry - package->entries];
+		if (buffer.empty())
+		{
+			buffer.resize(entry->size);
+			if (!Decompress(package->base + entry->offset, entry->storedSize, buffer.data(), buffer.size()))
+			{
+				E2D_WARNING(L"Package::find failed! Corrupted data.");
+				std::vector<BYTE>().swap(buffer);
+				return data;
+			}
+		}
+
+		data.buffer = buffer.data();
+		data.size = static_cast<int>(buffer.size());
+		return data;
+	}
+	return data;
+}
+
+bool easy2d::Package::build(const String& dirPath, const String& outFilePath, bool compress)
+{
+	String root = dirPath;
+	if (!root.empty() && root.back() != L'\\' && root.back() != L'/')
+	{
+		root.push_back(L'\\');
+	}
+
+	std::vector<String> files;
+	CollectFiles(root, L"", files);
+	if (files.empty())
+	{
+		E2D_WARNING(L"Package::build failed! No file found.");
+		return false;
+	}
+
+	std::ofstream out(outFilePath, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		E2D_WARNING(L"Package::build failed! Can not create output file.");
+		return false;
+	}
+
+	PackHeader header;
+	memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+	header.version = PACK_VERSION;
+	header.count = static_cast<UINT32>(files.size());
+	header.reserved = 0;
+	header.indexOffset = 0;
+	header.namesOffset = 0;
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	std::vector<PackEntry> entries;
+	std::vector<String> names;
+	std::vector<BYTE> content;
+	std::vector<BYTE> compressed;
+	UINT64 offset = sizeof(header);
+	const char padding[PACK_ALIGNMENT] = { 0 };
+
+	for (const auto& file : files)
+	{
+		std::ifstream in(root + file, std::ios::binary);
+		if (!in)
+		{
+			E2D_WARNING(L"Package::build failed! Can not read file.");
+			return false;
+		}
+		content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+		// ݿ鰴 16 ֽڶ
+		UINT64 aligned = (offset + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT;
+		out.write(padding, static_cast<std::streamsize>(aligned - offset));
+		offset = aligned;
+
+		PackEntry entry;
+		entry.offset = offset;
+		entry.size = static_cast<UINT32>(content.size());
+		entry.flags = 0;
+
+		if (compress && !content.empty() && Compress(content.data(), content.size(), compressed))
+		{
+			entry.flags |= PACK_FLAG_COMPRESSED;
+			entry.storedSize = static_cast<UINT32>(compressed.size());
+			out.write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+		}
+		else
+		{
+			entry.storedSize = entry.size;
+			out.write(reinterpret_cast<const char*>(content.data()), content.size());
+		}
+		offset += entry.storedSize;
+
+		names.push_back(NormalizeName(file));
+		entry.hash = HashName(names.back());
+		entries.push_back(entry);
+	}
+
+	// ϣļͬ˳
+	std::vector<size_t> order(entries.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&entries](size_t a, size_t b) { return entries[a].hash < entries[b].hash; });
+
+	UINT64 aligned = (offset + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT;
+	out.write(padding, static_cast<std::streamsize>(aligned - offset));
+	header.indexOffset = aligned;
+
+	UINT32 nameOffset = 0;
+	for (auto i : order)
+	{
+		PackEntry entry = entries[i];
+		entry.nameOffset = nameOffset;
+		entry.nameLength = static_cast<UINT16>(names[i].size());
+		nameOffset += entry.nameLength;
+		out.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+	}
+
+	header.namesOffset = header.indexOffset + entries.size() * sizeof(PackEntry);
+	for (auto i : order)
+	{
+		for (auto ch : names[i])
+		{
+			UINT16 unit = static_cast<UINT16>(ch);
+			out.write(reinterpret_cast<const char*>(&unit), sizeof(unit));
+		}
+	}
+
+	out.seekp(0);
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	return out.good();
+}
+
+void easy2d::Package::__uninit()
+{
+	Package::unmountAll();
+}
@@ -1,6 +1,9 @@
 #include <easy2d/e2dtool.h>
 #include <algorithm>
 #include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <chrono>
 #include <commdlg.h>
 
 #define DEFINE_KNOWN_FOLDER(name, l, w1, w2, b1, b2, b3, b4, b5, b6, b7, b8) \
@@ -14,6 +17,119 @@ static easy2d::String s_sLocalAppDataPath;
 static easy2d::String s_sTempPath;
 static easy2d::String s_sDataSavePath;
 static std::list<easy2d::String> s_vPathList;
+// 棬δҵļӦַ
+static std::unordered_map<easy2d::String, easy2d::String> s_mResolvedPaths;
+// ·ļ·ͳһʽ
+static std::unordered_map<easy2d::String, std::unordered_set<easy2d::String>> s_mPathIndices;
+static easy2d::Path::SearchStats s_SearchStats = { 0 };
+
+
+namespace
+{
+	// ͳһ·ʽСдʹ÷бָܷȥͷĵǰĿ¼ĩβķָ
+	// ʹ "dir"  "dir\\" ͬһļ
+	easy2d::String NormalizePath(const easy2d::String& path)
+	{
+		easy2d::String result = path;
+		std::transform(result.begin(), result.end(), result.begin(), [](wchar_t ch)
+		{
+			return ch == L'/' ? L'\\' : static_cast<wchar_t>(::towlower(ch));
+		});
+
+		while (result.compare(0, 2, L".\\") == 0)
+		{
+			result.erase(0, 2);
+		}
+
+		while (!result.empty() && result.back() == L'\\')
+		{
+			result.pop_back();
+		}
+		return result;
+	}
+
+	// ·Ͱ ".." ·޷ͨĿ¼
+	bool IsIndexable(const easy2d::String& path)
+	{
+		if (path.empty() || path[0] == L'\\' || path[0] == L'/')
+			return false;
+		if (path.find(L':') != easy2d::String::npos)
+			return false;
+		return path.find(L"..") == easy2d::String::npos;
+	}
+
+	// ݹ¼ļеļ
+	void BuildIndex(const easy2d::String& root, const easy2d::String& relative, std::unordered_set<easy2d::String>& index)
+	{
+		WIN32_FIND_DATAW findData;
+		HANDLE hFind = ::FindFirstFileW((root + relative + L"*").c_str(), &findData);
+		if (hFind == INVALID_HANDLE_VALUE)
+			return;
+
+		do
+		{
+			easy2d::String name = findData.cFileName;
+			if (name == L"." || name == L"..")
+				continue;
+
+			if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			{
+				// ļбҲԱ
+				index.insert(NormalizePath(relative + name));
+				BuildIndex(root, relative + name + L"\\", index);
+			}
+			else
+			{
+				index.insert(NormalizePath(relative + name));
+			}
+		} while (::FindNextFileW(hFind, &findData));
+
+		::FindClose(hFind);
+	}
+
+	const std::unordered_set<easy2d::String>& GetIndex(const easy2d::String& resPath)
+	{
+		auto iter = s_mPathIndices.find(resPath);
+		if (iter == s_mPathIndices.end())
+		{
+			iter = s_mPathIndices.insert(std::make_pair(resPath, std::unordered_set<easy2d::String>())).first;
+			BuildIndex(resPath, L"", iter->second);
+			++s_SearchStats.indexBuilds;
+		}
+		return iter->second;
+	}
+
+	easy2d::String SearchFile(const easy2d::String& path)
+	{
+		if (easy2d::Path::exists(path))
+		{
+			return path;
+		}
+
+		if (IsIndexable(path))
+		{
+			easy2d::String key = NormalizePath(path);
+			for (auto& resPath : s_vPathList)
+			{
+				if (GetIndex(resPath).count(key))
+				{
+					return resPath + path;
+				}
+			}
+		}
+		else
+		{
+			for (auto& resPath : s_vPathList)
+			{
+				if (easy2d::Path::exists(resPath + path))
+				{
+					return resPath + path;
+				}
+			}
+		}
+		return easy2d::String();
+	}
+}
 
 bool easy2d::Path::__init(const String& gameName)
 {
@@ -85,6 +201,8 @@ void easy2d::Path::add(String path)
 	if (iter == s_vPathList.cend())
 	{
 		s_vPathList.push_front(path);
+		// µ·ȼߣ֮ǰļʧЧ
+		s_mResolvedPaths.clear();
 	}
 }
 
@@ -105,21 +223,35 @@ easy2d::String easy2d::Path::getExecutableFilePath()
 
 easy2d::String easy2d::Path::searchForFile(const String& path)
 {
-	if (Path::exists(path))
+	auto start = std::chrono::steady_clock::now();
+	++s_SearchStats.lookups;
+
+	String result;
+	auto iter = s_mResolvedPaths.find(path);
+	if (iter != s_mResolvedPaths.end())
 	{
-		return path;
+		++s_SearchStats.cacheHits;
+		result = iter->second;
 	}
 	else
 	{
-		for (auto& resPath : s_vPathList)
-		{
-			if (Path::exists(resPath + path))
-			{
-				return resPath + path;
-			}
-		}
+		result = SearchFile(path);
+		s_mResolvedPaths.insert(std::make_pair(path, result));
 	}
-	return String();
+
+	s_SearchStats.totalTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / 1000.f;
+	return result;
+}
+
+void easy2d::Path::clearSearchCache()
+{
+	s_mResolvedPaths.clear();
+	s_mPathIndices.clear();
+}
+
+easy2d::Path::SearchStats easy2d::Path::getSearchStats()
+{
+	return s_SearchStats;
 }
 
 easy2d::String easy2d::Path::extractResource(int resNameId, const String & resType, const String & destFileName)
@@ -214,3 +346,45 @@ bool easy2d::Path::exists(const String & path)
 	}
 	return ::_waccess(path.c_str(), 0) == 0;
 }
+
+bool easy2d::Path::writeFileAtomic(const String & filePath, const void * data, size_t size)
+{
+	if (filePath.empty() || (data == nullptr && size))
+	{
+		return false;
+	}
+
+	String tempPath = filePath + L".tmp";
+	HANDLE hFile = ::CreateFileW(tempPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	// WriteFile д 4GBֶд
+	const BYTE* bytes = static_cast<const BYTE*>(data);
+	bool succeeded = true;
+	while (succeeded && size)
+	{
+		DWORD chunk = static_cast<DWORD>(min(size, size_t(0x40000000)));
+		DWORD written = 0;
+		succeeded = ::WriteFile(hFile, bytes, chunk, &written, nullptr) && written == chunk;
+		bytes += chunk;
+		size -= chunk;
+	}
+
+	// ̺滻ԭļ
+	succeeded = succeeded && ::FlushFileBuffers(hFile);
+	::CloseHandle(hFile);
+
+	if (succeeded)
+	{
+		succeeded = ::MoveFileExW(tempPath.c_str(), filePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+	}
+
+	if (!succeeded)
+	{
+		::DeleteFileW(tempPath.c_str());
+	}
+	return succeeded;
+}
@@ -0,0 +1,581 @@
+#include <easy2d/e2dtool.h>
+#include <algorithm>
+
+namespace
+{
+	// 浵ʽ
+	// [SaveHeader][8 ֽڶ룩][SaveEntry ϣ][ֶUTF-16]
+	// У͸ļͷ֮ȫ
+	const char		SAVE_MAGIC[4] = { 'E', '2', 'S', 'V' };
+	const UINT32	SAVE_FORMAT_VERSION = 1;
+	const UINT64	SAVE_ALIGNMENT = 8;
+
+#pragma pack(push, 1)
+	struct SaveHeader
+	{
+		char	magic[4];
+		UINT32	formatVersion;
+		UINT32	schemaVersion;
+		UINT32	count;
+		UINT64	indexOffset;
+		UINT64	namesOffset;
+		UINT64	fileSize;
+		UINT32	checksum;
+		UINT32	reserved;
+	};
+
+	struct SaveEntry
+	{
+		UINT64	hash;
+		UINT64	offset;
+		UINT32	size;
+		UINT32	nameOffset;	// ֶֶеλãַ
+		UINT16	nameLength;
+		UINT16	type;
+		UINT32	reserved;
+	};
+#pragma pack(pop)
+
+	// FNV-1a 64 λϣ UTF-16 㣬ƽ̨޹
+	UINT64 HashName(const easy2d::String& name)
+	{
+		UINT64 hash = 14695981039346656037ULL;
+		for (auto ch : name)
+		{
+			UINT16 unit = static_cast<UINT16>(ch);
+			hash = (hash ^ (unit & 0xFF)) * 1099511628211ULL;
+			hash = (hash ^ (unit >> 8)) * 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	// CRC32IEEE 802.3ÿδ 4 ֽ
+	class Crc32
+	{
+	public:
+		Crc32()
+		{
+			for (UINT32 i = 0; i < 256; ++i)
+			{
+				UINT32 crc = i;
+				for (int j = 0; j < 8; ++j)
+				{
+					crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0);
+				}
+				_table[0][i] = crc;
+			}
+			for (UINT32 i = 0; i < 256; ++i)
+			{
+				for (int k = 1; k < 4; ++k)
+				{
+					_table[k][i] = (_table[k - 1][i] >> 8) ^ _table[0][_table[k - 1][i] & 0xFF];
+				}
+			}
+		}
+
+		UINT32 compute(const BYTE* data, size_t size) const
+		{
+			UINT32 crc = 0xFFFFFFFFu;
+			while (size >= 4)
+			{
+				crc ^= data[0] | (data[1] << 8) | (data[2] << 16) | (UINT32(data[3]) << 24);
+				crc = _table[3][crc & 0xFF] ^ _table[2][(crc >> 8) & 0xFF] ^
+					_table[1][(crc >> 16) & 0xFF] ^ _table[0][crc >> 24];
+				data += 4;
+				size -= 4;
+			}
+			while (size--)
+			{
+				crc = (crc >> 8) ^ _table[0][(crc ^ *data++) & 0xFF];
+			}
+			return crc ^ 0xFFFFFFFFu;
+		}
+
+	private:
+		UINT32 _table[4][256];
+	};
+
+	const Crc32& GetCrc32()
+	{
+		static Crc32 crc;
+		return crc;
+	}
+
+	UINT64 AlignUp(UINT64 value)
+	{
+		return (value + SAVE_ALIGNMENT - 1) & ~(SAVE_ALIGNMENT - 1);
+	}
+}
+
+easy2d::SaveWriter::SaveWriter(UINT32 schemaVersion)
+	: _schemaVersion(schemaVersion)
+	, _data()
+	, _fields()
+	, _index()
+{
+}
+
+void easy2d::SaveWriter::setInt(const String& name, int value)
+{
+	INT32 data = value;
+	_set(name, SaveFieldType::Int, &data, sizeof(data));
+}
+
+void easy2d::SaveWriter::setInt64(const String& name, INT64 value)
+{
+	_set(name, SaveFieldType::Int64, &value, sizeof(value));
+}
+
+void easy2d::SaveWriter::setFloat(const String& name, float value)
+{
+	_set(name, SaveFieldType::Float, &value, sizeof(value));
+}
+
+void easy2d::SaveWriter::setDouble(const String& name, double value)
+{
+	_set(name, SaveFieldType::Double, &value, sizeof(value));
+}
+
+void easy2d::SaveWriter::setString(const String& name, const String& value)
+{
+	// ͳһ UTF-16 
+	std::vector<UINT16> units(value.begin(), value.end());
+	_set(name, SaveFieldType::String, units.empty() ? nullptr : &units[0], static_cast<UINT32>(units.size() * sizeof(UINT16)));
+}
+
+void easy2d::SaveWriter::setBlob(const String& name, const void * data, UINT32 size)
+{
+	_set(name, SaveFieldType::Blob, data, data ? size : 0);
+}
+
+void easy2d::SaveWriter::setIntArray(const String& name, const int * values, UINT32 count)
+{
+	_set(name, SaveFieldType::IntArray, values, values ? count * sizeof(INT32) : 0);
+}
+
+void easy2d::SaveWriter::setFloatArray(const String& name, const float * values, UINT32 count)
+{
+	_set(name, SaveFieldType::FloatArray, values, values ? count * sizeof(float) : 0);
+}
+
+void easy2d::SaveWriter::clear()
+{
+	_data.clear();
+	_fields.clear();
+	_index.clear();
+}
+
+UINT32 easy2d::SaveWriter::getCount() const
+{
+	return static_cast<UINT32>(_fields.size());
+}
+
+void easy2d::SaveWriter::_set(const String& name, SaveFieldType::Value type, const void * data, UINT32 size)
+{
+	if (name.empty() || name.size() > 0xFFFF)
+	{
+		E2D_WARNING(L"SaveWriter: invalid field name.");
+		return;
+	}
+
+	// ֶֻͬһдݣԭпռ㹻ʱԭظǣ
+	// ׷ӵĩβµľڱʱ
+	auto iter = _index.find(name);
+	if (iter == _index.end())
+	{
+		Field field = { name, static_cast<UINT16>(type), _data.size(), 0, 0 };
+		iter = _index.insert(std::make_pair(name, _fields.size())).first;
+		_fields.push_back(field);
+	}
+
+	Field& field = _fields[iter->second];
+	if (size > field.capacity)
+	{
+		field.offset = _data.size();
+		field.capacity = size;
+		_data.resize(_data.size() + size);
+	}
+
+	field.type = static_cast<UINT16>(type);
+	field.size = size;
+	if (size)
+	{
+		::memcpy(&_data[field.offset], data, size);
+	}
+}
+
+void easy2d::SaveWriter::save(std::vector<BYTE>& buffer) const
+{
+	// ϣ
+	std::vector<std::pair<UINT64, size_t>> order;
+	order.reserve(_fields.size());
+	for (size_t i = 0; i < _fields.size(); ++i)
+	{
+		order.push_back(std::make_pair(HashName(_fields[i].name), i));
+	}
+	std::sort(order.begin(), order.end());
+
+	// ֻдֶεǰݣ 8 ֽڶ
+	std::vector<UINT64> offsets;
+	offsets.reserve(_fields.size());
+	UINT64 dataEnd = sizeof(SaveHeader);
+	for (const auto& field : _fields)
+	{
+		dataEnd = AlignUp(dataEnd);
+		offsets.push_back(dataEnd);
+		dataEnd += field.size;
+	}
+
+	UINT64 indexOffset = AlignUp(dataEnd);
+	UINT64 namesOffset = indexOffset + order.size() * sizeof(SaveEntry);
+
+	std::vector<SaveEntry> entries;
+	std::vector<UINT16> names;
+	entries.reserve(order.size());
+	for (const auto& item : order)
+	{
+		const Field& field = _fields[item.second];
+
+		SaveEntry entry = { 0 };
+		entry.hash = item.first;
+		entry.offset = offsets[item.second];
+		entry.size = field.size;
+		entry.nameOffset = static_cast<UINT32>(names.size());
+		entry.nameLength = static_cast<UINT16>(field.name.size());
+		entry.type = field.type;
+		entries.push_back(entry);
+
+		names.insert(names.end(), field.name.begin(), field.name.end());
+	}
+
+	UINT64 fileSize = namesOffset + names.size() * sizeof(UINT16);
+	buffer.assign(static_cast<size_t>(fileSize), 0);
+
+	for (size_t i = 0; i < _fields.size(); ++i)
+	{
+		if (_fields[i].size)
+		{
+			::memcpy(&buffer[static_cast<size_t>(offsets[i])], &_data[_fields[i].offset], _fields[i].size);
+		}
+	}
+	if (!entries.empty())
+	{
+		::memcpy(&buffer[static_cast<size_t>(indexOffset)], &entries[0], entries.size() * sizeof(SaveEntry));
+	}
+	if (!names.empty())
+	{
+		::memcpy(&buffer[static_cast<size_t>(namesOffset)], &names[0], names.size() * sizeof(UINT16));
+	}
+
+	SaveHeader header = { { 0 } };
+	::memcpy(header.magic, SAVE_MAGIC, sizeof(SAVE_MAGIC));
+	header.formatVersion = SAVE_FORMAT_VERSION;
+	header.schemaVersion = _schemaVersion;
+	header.count = static_cast<UINT32>(entries.size());
+	header.indexOffset = indexOffset;
+	header.namesOffset = namesOffset;
+	header.fileSize = fileSize;
+	header.checksum = GetCrc32().compute(&buffer[sizeof(SaveHeader)], buffer.size() - sizeof(SaveHeader));
+	::memcpy(&buffer[0], &header, sizeof(header));
+}
+
+bool easy2d::SaveWriter::save(const String& filePath) const
+{
+	std::vector<BYTE> buffer;
+	save(buffer);
+
+	if (!Path::writeFileAtomic(filePath, &buffer[0], buffer.size()))
+	{
+		E2D_WARNING(L"SaveWriter::save failed to write the file!");
+		return false;
+	}
+	return true;
+}
+
+
+easy2d::SaveReader::SaveReader()
+	: _base(nullptr)
+	, _size(0)
+	, _entries(nullptr)
+	, _names(nullptr)
+	, _count(0)
+	, _schemaVersion(0)
+	, _mapping()
+{
+}
+
+easy2d::SaveReader::~SaveReader()
+{
+	close();
+}
+
+bool easy2d::SaveReader::open(const String& filePath, bool verify)
+{
+	close();
+
+	FileMapping mapping;
+	if (!mapping.open(filePath) || !parse(mapping.getData(), mapping.getSize(), verify))
+		return false;
+
+	// ȡֱֶļӳ䣬ӳ䱣 close
+	_mapping.swap(mapping);
+	return true;
+}
+
+bool easy2d::SaveReader::parse(const void * buffer, size_t size, bool verify)
+{
+	close();
+
+	const BYTE* base = static_cast<const BYTE*>(buffer);
+	if (base == nullptr || size < sizeof(SaveHeader))
+		return false;
+
+	SaveHeader header;
+	::memcpy(&header, base, sizeof(header));
+
+	if (::memcmp(header.magic, SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0 ||
+		header.formatVersion != SAVE_FORMAT_VERSION ||
+		header.fileSize != size ||
+		header.indexOffset < sizeof(SaveHeader) ||
+		header.indexOffset % SAVE_ALIGNMENT != 0 ||
+		header.namesOffset != header.indexOffset + UINT64(header.count) * sizeof(SaveEntry) ||
+		header.namesOffset > size)
+	{
+		E2D_WARNING(L"SaveReader: invalid save data.");
+		return false;
+	}
+
+	if (verify && GetCrc32().compute(base + sizeof(SaveHeader), size - sizeof(SaveHeader)) != header.checksum)
+	{
+		E2D_WARNING(L"SaveReader: checksum mismatch.");
+		return false;
+	}
+
+	// еλã֮ȡֶʱټ
+	const BYTE* entries = base + header.indexOffset;
+	UINT64 namesLength = (size - header.namesOffset) / sizeof(UINT16);
+	for (UINT32 i = 0; i < header.count; ++i)
+	{
+		SaveEntry entry;
+		::memcpy(&entry, entries + i * sizeof(SaveEntry), sizeof(entry));
+		if (entry.offset < sizeof(SaveHeader) ||
+			entry.offset > header.indexOffset ||
+			entry.size > header.indexOffset - entry.offset ||
+			UINT64(entry.nameOffset) + entry.nameLength > namesLength)
+		{
+			E2D_WARNING(L"SaveReader: invalid save data.");
+			return false;
+		}
+	}
+
+	_base = base;
+	_size = size;
+	_entries = entries;
+	_names = base + header.namesOffset;
+	_count = header.count;
+	_schemaVersion = header.schemaVersion;
+	return true;
+}
+
+void easy2d::SaveReader::close()
+{
+	_mapping.close();
+
+	_base = nullptr;
+	_size = 0;
+	_entries = nullptr;
+	_names = nullptr;
+	_count = 0;
+	_schemaVersion = 0;
+}
+
+bool easy2d::SaveReader::isOpened() const
+{
+	return _base != nullptr;
+}
+
+UINT32 easy2d::SaveReader::getSchemaVersion() const
+{
+	return _schemaVersion;
+}
+
+UINT32 easy2d::SaveReader::getCount() const
+{
+	return _count;
+}
+
+bool easy2d::SaveReader::contains(const String& name) const
+{
+	return getType(name) != SaveFieldType::Unknown;
+}
+
+easy2d::SaveFieldType::Value easy2d::SaveReader::getType(const String& name) const
+{
+	SaveFieldType::Value type = SaveFieldType::Unknown;
+	UINT32 size = 0;
+	_find(name, &type, &size);
+	return type;
+}
+
+int easy2d::SaveReader::getInt(const String& name, int defaultValue) const
+{
+	SaveFieldType::Value type;
+	UINT32 size = 0;
+	const BYTE* data = _find(name, &type, &size);
+	if (data == nullptr || type != SaveFieldType::Int || size != sizeof(INT32))
+		return defaultValue;
+
+	INT32 value;
+	::memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+INT64 easy2d::SaveReader::getInt64(const String& name, INT64 defaultValue) const
+{
+	SaveFieldType::Value type;
+	UINT32 size = 0;
+	const BYTE* data = _find(name, &type, &size);
+	if (data == nullptr || type != SaveFieldType::Int64 || size != sizeof(INT64))
+		return defaultValue;
+
+	INT64 value;
+	::memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+float easy2d::SaveReader::getFloat(const String& name, float defaultValue) const
+{
+	SaveFieldType::Value type;
+	UINT32 size = 0;
+	const BYTE* data = _find(name, &type, &size);
+	if (data == nullptr || type != SaveFieldType::Float || size != sizeof(float))
+		return defaultValue;
+
+	float value;
+	::memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+double easy2d::SaveReader::getDouble(const String& name, double defaultValue) const
+{
+	SaveFieldType::Value type;
+	UINT32 size = 0;
+	const BYTE* data = _find(name, &type, &size);
+	if (data == nullptr || type != SaveFieldType::Double || size != sizeof(double))
+		return defaultValue;
+
+	double value;
+	::memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+easy2d::String easy2d::SaveReader::getString(const String& name, const String& defaultValue) const
+{
+	SaveFieldType::Value type;
+	UINT32 size = 0;
+	const BYTE* data = _find(name, &type, &size);
+	if (data == nullptr || type != SaveFieldType::String)
+		return defaultValue;
+
+	String value(size / sizeof(UINT16), L'\0');
+	for (size_t i = 0; i < value.size(); ++i)
+	{
+		value[i] = static_cast<wchar_t>(data[i * 2] | (data[i * 2 + 1] << 8));
+	}
+	return value;
+}
+
+const void * easy2d::SaveReader::getBlob(const String& name, UINT32 * size) const
+{
+	SaveFieldType::Value type;
+	UINT32 dataSize = 0;
+	const BYTE* data = _find(name, &type, &dataSize);
+	if (type != SaveFieldType::Blob)
+		data = nullptr;
+
+	if (size)
+	{
+		*size = data ? dataSize : 0;
+	}
+	return data;
+}
+
+const int * easy2d::SaveReader::getIntArray(const String& name, UINT32 * count) const
+{
+	SaveFieldType::Value type;
+	UINT32 size = 0;
+	const BYTE* data = _find(name, &type, &size);
+	if (type != SaveFieldType::IntArray)
+		data = nullptr;
+
+	if (count)
+	{
+		*count = data ? size / sizeof(INT32) : 0;
+	}
+	return reinterpret_cast<const int*>(data);
+}
+
+const float * easy2d::SaveReader::getFloatArray(const String& name, UINT32 * count) const
+{
+	SaveFieldType::Value type;
+	UINT32 size = 0;
+	const BYTE* data = _find(name, &type, &size);
+	if (type != SaveFieldType::FloatArray)
+		data = nullptr;
+
+	if (count)
+	{
+		*count = data ? size / sizeof(float) : 0;
+	}
+	return reinterpret_cast<const float*>(data);
+}
+
+const BYTE * easy2d::SaveReader::_find(const String& name, SaveFieldType::Value * type, UINT32 * size) const
+{
+	*type = SaveFieldType::Unknown;
+	*size = 0;
+
+	if (_base == nullptr || name.empty())
+		return nullptr;
+
+	UINT64 hash = HashName(name);
+
+	// ϣУֲҵһϣֶͬ
+	UINT32 low = 0, high = _count;
+	while (low < high)
+	{
+		UINT32 mid = (low + high) / 2;
+		UINT64 midHash;
+		::memcpy(&midHash, _entries + mid * sizeof(SaveEntry), sizeof(midHash));
+		if (midHash < hash)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	for (UINT32 i = low; i < _count; ++i)
+	{
+		SaveEntry entry;
+		::memcpy(&entry, _entries + i * sizeof(SaveEntry), sizeof(entry));
+		if (entry.hash != hash)
+			break;
+
+		if (entry.nameLength != name.size())
+			continue;
+
+		const BYTE* entryName = _names + entry.nameOffset * sizeof(UINT16);
+		bool same = true;
+		for (UINT16 j = 0; j < entry.nameLength && same; ++j)
+		{
+			UINT16 unit = entryName[j * 2] | (entryName[j * 2 + 1] << 8);
+			same = (unit == static_cast<UINT16>(name[j]));
+		}
+		if (!same)
+			continue;
+
+		*type = SaveFieldType::Value(entry.type);
+		*size = entry.size;
+		return _base + entry.offset;
+	}
+	return nullptr;
+}
@@ -0,0 +1,107 @@
+#include <easy2d/e2dtool.h>
+
+
+easy2d::Sound::Sound()
+{
+}
+
+easy2d::Sound::Sound(const String & filePath)
+	: Sound()
+{
+	this->open(filePath);
+}
+
+easy2d::Sound::Sound(int resNameId, const String & resType)
+	: Sound()
+{
+	this->open(resNameId, resType);
+}
+
+easy2d::Sound::~Sound()
+{
+	close();
+}
+
+bool easy2d::Sound::open(const String & filePath)
+{
+	if (_wave.isValid())
+	{
+		E2D_WARNING(L"Sound can be opened only once!");
+		return false;
+	}
+
+	if (filePath.empty())
+	{
+		E2D_WARNING(L"Sound::open Invalid file name.");
+		return false;
+	}
+
+	if (!Music::__decode(filePath, _wave))
+		return false;
+
+	// ǰøʽ
+	SoundPool::prepare(this);
+	return true;
+}
+
+bool easy2d::Sound::open(int resNameId, const String & resType)
+{
+	if (_wave.isValid())
+	{
+		E2D_WARNING(L"Sound can be opened only once!");
+		return false;
+	}
+
+	if (!Music::__decode(resNameId, resType, _wave))
+		return false;
+
+	SoundPool::prepare(this);
+	return true;
+}
+
+bool easy2d::Sound::play(int priority, float volume, int loopCount)
+{
+	return SoundPool::play(this, priority, volume, loopCount);
+}
+
+void easy2d::Sound::stop()
+{
+	SoundPool::stop(this);
+}
+
+void easy2d::Sound::close()
+{
+	// ͻڶȡ
+	if (_wave.isValid())
+	{
+		SoundPool::stop(this);
+		AudioMixer::__stop(this);
+	}
+
+	_wave.close();
+}
+
+bool easy2d::Sound::isOpened() const
+{
+	return _wave.isValid();
+}
+
+const WAVEFORMATEX * easy2d::Sound::getFormat() const
+{
+	return _wave.getFormat();
+}
+
+const BYTE * easy2d::Sound::getData() const
+{
+	return _wave.getData();
+}
+
+UINT32 easy2d::Sound::getDataSize() const
+{
+	return _wave.getDataSize();
+}
+
+float easy2d::Sound::getDuration() const
+{
+	return _wave.getDuration();
+}
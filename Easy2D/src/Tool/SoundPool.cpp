@@ -0,0 +1,350 @@
+#include <easy2d/e2dtool.h>
+
+namespace
+{
+	// 
+	struct VoiceSlot
+	{
+		easy2d::SoundVoice* voice;
+		easy2d::Sound* sound;		// ڲŵЧʱΪ nullptr
+		int priority;
+		UINT64 order;				// ʼŵ˳ռЧ
+	};
+
+	// ͬһƵʽһ
+	struct VoiceGroup
+	{
+		std::vector<BYTE> format;
+		std::vector<VoiceSlot> slots;
+	};
+
+	std::vector<VoiceGroup> s_vGroups;
+	easy2d::SoundBackend* s_pBackend = nullptr;
+	bool s_bDefaultBackendFailed = false;
+	int s_nVoiceCount = 8;
+	float s_fSoundVolume = 1.f;
+	UINT64 s_nPlayOrder = 0;
+	easy2d::SoundPool::Stats s_Stats = { 0 };
+
+	// ֹͣͷеЧ
+	void ReleaseSlot(VoiceSlot& slot)
+	{
+		if (slot.sound)
+		{
+			slot.voice->stop();
+
+			// ÿͷţЧʱٴνЧ
+			easy2d::Sound* sound = slot.sound;
+			slot.sound = nullptr;
+			easy2d::GC::release(sound);
+		}
+	}
+
+	// ѲϵǷ
+	bool RefreshSlot(VoiceSlot& slot)
+	{
+		if (slot.sound && !slot.voice->isPlaying())
+		{
+			ReleaseSlot(slot);
+		}
+		return slot.sound == nullptr;
+	}
+
+	void DestroyGroups()
+	{
+		for (auto& group : s_vGroups)
+		{
+			for (auto& slot : group.slots)
+			{
+				ReleaseSlot(slot);
+				delete slot.voice;
+			}
+		}
+		s_vGroups.clear();
+	}
+
+	VoiceGroup* FindGroup(const WAVEFORMATEX* format)
+	{
+		size_t size = sizeof(WAVEFORMATEX) + format->cbSize;
+		for (auto& group : s_vGroups)
+		{
+			if (group.format.size() == size && memcmp(&group.format[0], format, size) == 0)
+				return &group;
+		}
+		return nullptr;
+	}
+}
+
+
+easy2d::NullSoundBackend::NullSoundBackend(bool realTime)
+	: _realTime(realTime)
+	, _voiceCount(0)
+{
+}
+
+easy2d::SoundVoice * easy2d::NullSoundBackend::createVoice(const WAVEFORMATEX * format)
+{
+	// 
+	class NullSoundVoice :
+		public SoundVoice
+	{
+	public:
+		NullSoundVoice(UINT32 bytesPerSecond, bool realTime)
+			: _bytesPerSecond(bytesPerSecond)
+			, _realTime(realTime)
+			, _playing(false)
+			, _duration(0)
+		{
+		}
+
+		virtual bool play(const BYTE * data, UINT32 size, int loopCount) override
+		{
+			_playing = true;
+			_startTime = std::chrono::steady_clock::now();
+			_duration = (_bytesPerSecond && loopCount >= 0)
+				? double(size) * (loopCount + 1) / _bytesPerSecond
+				: -1;
+			return true;
+		}
+
+		virtual void stop() override
+		{
+			_playing = false;
+		}
+
+		virtual bool isPlaying() override
+		{
+			if (_playing && _realTime && _duration >= 0)
+			{
+				std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - _startTime;
+				if (elapsed.count() >= _duration)
+				{
+					_playing = false;
+				}
+			}
+			return _playing;
+		}
+
+		virtual void setVolume(float volume) override
+		{
+		}
+
+	private:
+		UINT32	_bytesPerSecond;
+		bool	_realTime;
+		bool	_playing;
+		double	_duration;
+		std::chrono::steady_clock::time_point _startTime;
+	};
+
+	++_voiceCount;
+	return new (std::nothrow) NullSoundVoice(format ? format->nAvgBytesPerSec : 0, _realTime);
+}
+
+UINT32 easy2d::NullSoundBackend::getVoiceCount() const
+{
+	return _voiceCount;
+}
+
+
+bool easy2d::SoundPool::play(Sound * sound, int priority, float volume, int loopCount)
+{
+	if (sound == nullptr || !sound->isOpened())
+	{
+		E2D_WARNING(L"SoundPool::play Failed: Sound must be opened first!");
+		return false;
+	}
+
+	if (!SoundPool::prepare(sound))
+		return false;
+
+	VoiceGroup* group = FindGroup(sound->getFormat());
+
+	// ʹÿѡȼ翪ʼ
+	VoiceSlot* target = nullptr;
+	for (auto& slot : group->slots)
+	{
+		if (RefreshSlot(slot))
+		{
+			target = &slot;
+			break;
+		}
+
+		if (target == nullptr ||
+			slot.priority < target->priority ||
+			(slot.priority == target->priority && slot.order < target->order))
+		{
+			target = &slot;
+		}
+	}
+
+	if (target == nullptr || (target->sound && target->priority > priority))
+	{
+		++s_Stats.droppedCount;
+		return false;
+	}
+
+	if (target->sound)
+	{
+		ReleaseSlot(*target);
+		++s_Stats.stolenCount;
+	}
+
+	target->voice->setVolume(volume * s_fSoundVolume);
+	if (!target->voice->play(sound->getData(), sound->getDataSize(), loopCount))
+	{
+		E2D_WARNING(L"SoundPool::play Failed: Submit buffer error!");
+		return false;
+	}
+
+	// ڼ䱣Ч֤Ч
+	target->sound = sound;
+	target->priority = priority;
+	target->order = ++s_nPlayOrder;
+	GC::retain(target->sound);
+
+	++s_Stats.playCount;
+	return true;
+}
+
+void easy2d::SoundPool::stop(Sound * sound)
+{
+	if (sound == nullptr)
+		return;
+
+	for (auto& group : s_vGroups)
+	{
+		for (auto& slot : group.slots)
+		{
+			if (slot.sound == sound)
+			{
+				ReleaseSlot(slot);
+			}
+		}
+	}
+}
+
+void easy2d::SoundPool::stopAll()
+{
+	for (auto& group : s_vGroups)
+	{
+		for (auto& slot : group.slots)
+		{
+			ReleaseSlot(slot);
+		}
+	}
+}
+
+bool easy2d::SoundPool::prepare(Sound * sound)
+{
+	if (sound == nullptr || !sound->isOpened())
+		return false;
+
+	if (FindGroup(sound->getFormat()))
+		return true;
+
+	SoundBackend * backend = SoundPool::__getBackend();
+	if (backend == nullptr)
+		return false;
+
+	VoiceGroup group;
+	const BYTE* format = reinterpret_cast<const BYTE*>(sound->getFormat());
+	group.format.assign(format, format + sizeof(WAVEFORMATEX) + sound->getFormat()->cbSize);
+	group.slots.reserve(s_nVoiceCount);
+
+	for (int i = 0; i < s_nVoiceCount; ++i)
+	{
+		SoundVoice * voice = backend->createVoice(sound->getFormat());
+		if (voice == nullptr)
+			break;
+
+		VoiceSlot slot = { voice, nullptr, 0, 0 };
+		group.slots.push_back(slot);
+	}
+
+	if (group.slots.empty())
+	{
+		E2D_WARNING(L"SoundPool::prepare Failed: Create voice error!");
+		return false;
+	}
+
+	s_vGroups.push_back(group);
+	return true;
+}
+
+void easy2d::SoundPool::setVoiceCount(int count)
+{
+	s_nVoiceCount = max(count, 1);
+}
+
+float easy2d::SoundPool::getVolume()
+{
+	return s_fSoundVolume;
+}
+
+void easy2d::SoundPool::setVolume(float volume)
+{
+	s_fSoundVolume = min(max(volume, -224), 224);
+}
+
+void easy2d::SoundPool::setBackend(SoundBackend * backend)
+{
+	DestroyGroups();
+
+	delete s_pBackend;
+	s_pBackend = backend;
+	s_bDefaultBackendFailed = false;
+}
+
+easy2d::SoundPool::Stats easy2d::SoundPool::getStats()
+{
+	Stats stats = s_Stats;
+	stats.formatCount = static_cast<UINT32>(s_vGroups.size());
+	stats.voiceCount = 0;
+	stats.activeCount = 0;
+
+	for (const auto& group : s_vGroups)
+	{
+		for (const auto& slot : group.slots)
+		{
+			++stats.voiceCount;
+
+			// ֻȡ״̬ϵ´βʱ
+			if (slot.sound && slot.voice->isPlaying())
+			{
+				++stats.activeCount;
+			}
+		}
+	}
+	return stats;
+}
+
+void easy2d::SoundPool::resetStats()
+{
+	s_Stats.playCount = 0;
+	s_Stats.stolenCount = 0;
+	s_Stats.droppedCount = 0;
+}
+
+easy2d::SoundBackend * easy2d::SoundPool::__getBackend()
+{
+	if (s_pBackend == nullptr && !s_bDefaultBackendFailed)
+	{
+		s_pBackend = Music::__createSoundBackend();
+		if (s_pBackend == nullptr)
+		{
+			E2D_WARNING(L"SoundPool: Sound backend is not available!");
+			s_bDefaultBackendFailed = true;
+		}
+	}
+	return s_pBackend;
+}
+
+void easy2d::SoundPool::__uninit()
+{
+	DestroyGroups();
+
+	delete s_pBackend;
+	s_pBackend = nullptr;
+	s_bDefaultBackendFailed = false;
+}
@@ -19,7 +19,7 @@ namespace easy2d
 			, runTimes(0)
 			, totalTimes(updateTimes)
 			, delay(max(delay, 0))
-			, lastTime(easy2d::Time::getTotalTime())
+			, elapsed(0)
 			, callback(func)
 			, name(name)
 		{
@@ -33,7 +33,7 @@ namespace easy2d
 			}
 
 			++runTimes;
-			lastTime += delay;
+			elapsed -= delay;
 
 			if (runTimes == totalTimes)
 			{
@@ -41,14 +41,15 @@ namespace easy2d
 			}
 		}
 
-		bool ready()
+		bool ready(float dt)
 		{
 			if (this->running)
 			{
 				if (this->delay == 0)
 					return true;
 
-				if ((easy2d::Time::getTotalTime() - this->lastTime) >= this->delay)
+				this->elapsed += dt;
+				if (this->elapsed >= this->delay)
 					return true;
 			}
 			return false;
@@ -60,7 +61,7 @@ namespace easy2d
 		int		runTimes;
 		int		totalTimes;
 		float	delay;
-		float	lastTime;
+		float	elapsed;
 		easy2d::String name;
 		easy2d::Function<void()> callback;
 	};
@@ -144,7 +145,7 @@ void easy2d::Timer::removeAll()
 	}
 }
 
-void easy2d::Timer::__update()
+void easy2d::Timer::__update(float dt)
 {
 	if (s_vTimers.empty() || Game::isPaused())
 		return;
@@ -161,7 +162,7 @@ void easy2d::Timer::__update()
 		else
 		{
 			// ¶ʱ
-			if (timer->ready())
+			if (timer->ready(dt))
 			{
 				timer->update();
 			}
@@ -175,7 +176,7 @@ void easy2d::Timer::__resetAll()
 {
 	for (auto timer : s_vTimers)
 	{
-		timer->lastTime = Time::getTotalTime();
+		timer->elapsed = 0;
 	}
 }
 
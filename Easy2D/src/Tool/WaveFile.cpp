@@ -0,0 +1,340 @@
+#include <easy2d/e2dtool.h>
+
+namespace
+{
+	const UINT16 FORMAT_PCM = 0x0001;
+	const UINT16 FORMAT_IEEE_FLOAT = 0x0003;
+	const UINT16 FORMAT_IMA_ADPCM = 0x0011;
+	const UINT16 FORMAT_EXTENSIBLE = 0xFFFE;
+
+	// fmt  WAVEFORMATEX ֮ǰĹ̶֣ cbSize
+	const UINT32 PCM_FORMAT_SIZE = 16;
+
+	const int IMA_INDEX_TABLE[16] =
+	{
+		-1, -1, -1, -1, 2, 4, 6, 8,
+		-1, -1, -1, -1, 2, 4, 6, 8
+	};
+
+	const int IMA_STEP_TABLE[89] =
+	{
+		7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+		19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+		50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+		130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+		337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+		876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+		2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+		5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+		15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+	};
+
+	// СȡҪַ
+	inline UINT16 ReadU16(const BYTE* p)
+	{
+		return static_cast<UINT16>(p[0] | (p[1] << 8));
+	}
+
+	inline UINT32 ReadU32(const BYTE* p)
+	{
+		return static_cast<UINT32>(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24));
+	}
+
+	// һ 4 λ IMA ADPCM 
+	inline short DecodeImaNibble(int nibble, int& predictor, int& index)
+	{
+		int step = IMA_STEP_TABLE[index];
+		int diff = step >> 3;
+		if (nibble & 1) diff += step >> 2;
+		if (nibble & 2) diff += step >> 1;
+		if (nibble & 4) diff += step;
+
+		predictor += (nibble & 8) ? -diff : diff;
+		predictor = min(max(predictor, -32768), 32767);
+
+		index = min(max(index + IMA_INDEX_TABLE[nibble], 0), 88);
+		return static_cast<short>(predictor);
+	}
+}
+
+
+easy2d::WaveFile::WaveFile()
+	: _data(nullptr)
+	, _dataSize(0)
+	, _buffer(nullptr)
+	, _mapping()
+	, _package(nullptr)
+{
+}
+
+easy2d::WaveFile::~WaveFile()
+{
+	close();
+}
+
+bool easy2d::WaveFile::open(const String & filePath)
+{
+	close();
+
+	FileMapping mapping;
+	if (!mapping.open(filePath) || mapping.getSize() < 12 || UINT64(mapping.getSize()) > 0xFFFFFFFFULL)
+		return false;
+
+	if (!parse(mapping.getData(), mapping.getSize()))
+	{
+		close();
+		return false;
+	}
+
+	// ļӳʱӳ䣬ݲҪ
+	if (!_buffer)
+	{
+		_mapping.swap(mapping);
+	}
+	return true;
+}
+
+bool easy2d::WaveFile::parse(const void * buffer, size_t size)
+{
+	close();
+
+	const BYTE* base = static_cast<const BYTE*>(buffer);
+	if (base == nullptr || size < 12 ||
+		memcmp(base, "RIFF", 4) != 0 ||
+		memcmp(base + 8, "WAVE", 4) != 0)
+	{
+		return false;
+	}
+
+	//  fmt  data 
+	const BYTE* fmt = nullptr;
+	const BYTE* data = nullptr;
+	UINT32 fmtSize = 0;
+	UINT32 dataSize = 0;
+
+	size_t offset = 12;
+	while (offset + 8 <= size && (!fmt || !data))
+	{
+		const BYTE* chunk = base + offset;
+		UINT32 chunkSize = ReadU32(chunk + 4);
+		size_t available = size - offset - 8;
+
+		if (memcmp(chunk, "fmt ", 4) == 0)
+		{
+			if (chunkSize > available)
+				return false;
+			fmt = chunk + 8;
+			fmtSize = chunkSize;
+		}
+		else if (memcmp(chunk, "data", 4) == 0)
+		{
+			// ֳд data С׼ȷļʵʴСΪ׼
+			data = chunk + 8;
+			dataSize = static_cast<UINT32>(min(static_cast<size_t>(chunkSize), available));
+		}
+
+		// 鰴 2 ֽڶ
+		offset += 8 + static_cast<size_t>(chunkSize) + (chunkSize & 1);
+	}
+
+	if (fmt == nullptr || data == nullptr || fmtSize < PCM_FORMAT_SIZE)
+		return false;
+
+	UINT16 cbSize = (fmtSize >= sizeof(WAVEFORMATEX)) ? ReadU16(fmt + PCM_FORMAT_SIZE) : 0;
+	cbSize = static_cast<UINT16>(min(static_cast<UINT32>(cbSize), fmtSize - min(fmtSize, static_cast<UINT32>(sizeof(WAVEFORMATEX)))));
+
+	// ƸʽϢȱ cbSize ʱ
+	std::vector<BYTE> format(sizeof(WAVEFORMATEX) + cbSize, 0);
+	memcpy(&format[0], fmt, min(fmtSize, static_cast<UINT32>(format.size())));
+
+	WAVEFORMATEX* wfx = reinterpret_cast<WAVEFORMATEX*>(&format[0]);
+	wfx->cbSize = cbSize;
+
+	if (wfx->nChannels == 0 || wfx->nSamplesPerSec == 0 || wfx->nBlockAlign == 0)
+		return false;
+
+	UINT16 tag = wfx->wFormatTag;
+	if (tag == FORMAT_EXTENSIBLE)
+	{
+		// WAVEFORMATEXTENSIBLE  SubFormat ǰֽڼΪʵʵĸʽ
+		if (cbSize < 22)
+			return false;
+		tag = ReadU16(&format[sizeof(WAVEFORMATEX) + 6]);
+	}
+
+	UINT16 bits = wfx->wBitsPerSample;
+	if ((tag == FORMAT_PCM && (bits == 8 || bits == 16 || bits == 24 || bits == 32)) ||
+		(tag == FORMAT_IEEE_FLOAT && bits == 32))
+	{
+		if (wfx->nBlockAlign != wfx->nChannels * bits / 8)
+			return false;
+
+		// ֱԭʼڴ棬ԴʱԴӳ
+		_format.swap(format);
+		_data = data;
+		_dataSize = dataSize - dataSize % wfx->nBlockAlign;
+		if (Package::retain(buffer))
+		{
+			_package = buffer;
+		}
+		return true;
+	}
+
+	if (tag == FORMAT_IMA_ADPCM && bits == 4 && cbSize >= 2)
+	{
+		UINT32 samplesPerBlock = ReadU16(&format[sizeof(WAVEFORMATEX)]);
+		return _decodeImaAdpcm(data, dataSize, wfx, samplesPerBlock);
+	}
+
+	// 뽻 Media Foundation
+	return false;
+}
+
+void easy2d::WaveFile::close()
+{
+	_mapping.close();
+
+	if (_package)
+	{
+		Package::release(_package);
+		_package = nullptr;
+	}
+
+	delete[] _buffer;
+	_buffer = nullptr;
+	_data = nullptr;
+	_dataSize = 0;
+	_format.clear();
+}
+
+bool easy2d::WaveFile::isValid() const
+{
+	return _data != nullptr;
+}
+
+bool easy2d::WaveFile::isInPlace() const
+{
+	return _data != nullptr && _buffer == nullptr;
+}
+
+const WAVEFORMATEX * easy2d::WaveFile::getFormat() const
+{
+	if (_format.empty())
+		return nullptr;
+	return reinterpret_cast<const WAVEFORMATEX*>(&_format[0]);
+}
+
+const BYTE * easy2d::WaveFile::getData() const
+{
+	return _data;
+}
+
+UINT32 easy2d::WaveFile::getDataSize() const
+{
+	return _dataSize;
+}
+
+float easy2d::WaveFile::getDuration() const
+{
+	const WAVEFORMATEX * format = getFormat();
+	if (format == nullptr || format->nAvgBytesPerSec == 0)
+		return 0;
+	return float(_dataSize) / format->nAvgBytesPerSec;
+}
+
+void easy2d::WaveFile::_assign(BYTE * data, UINT32 size, const WAVEFORMATEX * format)
+{
+	close();
+
+	const BYTE* begin = reinterpret_cast<const BYTE*>(format);
+	_format.assign(begin, begin + sizeof(WAVEFORMATEX) + format->cbSize);
+	_buffer = data;
+	_data = data;
+	_dataSize = size;
+}
+
+void easy2d::WaveFile::_swap(WaveFile & other)
+{
+	std::swap(_format, other._format);
+	std::swap(_data, other._data);
+	std::swap(_dataSize, other._dataSize);
+	std::swap(_buffer, other._buffer);
+	_mapping.swap(other._mapping);
+	std::swap(_package, other._package);
+}
+
+bool easy2d::WaveFile::_decodeImaAdpcm(const BYTE * data, UINT32 size, const WAVEFORMATEX * format, UINT32 samplesPerBlock)
+{
+	// ÿԸ 4 ֽڵĿͷʼʼ
+	// ֮ 4 ֽڣ8 
+	const UINT32 channels = format->nChannels;
+	const UINT32 blockAlign = format->nBlockAlign;
+	const UINT32 headerSize = 4 * channels;
+
+	if (blockAlign <= headerSize ||
+		samplesPerBlock != (blockAlign - headerSize) / (4 * channels) * 8 + 1)
+	{
+		return false;
+	}
+
+	// ֡һܲ
+	UINT32 frames = 0;
+	for (UINT32 offset = 0; offset + headerSize <= size; offset += blockAlign)
+	{
+		UINT32 blockSize = min(blockAlign, size - offset);
+		frames += 1 + (blockSize - headerSize) / (4 * channels) * 8;
+	}
+
+	if (frames == 0)
+		return false;
+
+	BYTE* buffer = new (std::nothrow) BYTE[frames * channels * 2];
+	if (buffer == nullptr)
+	{
+		E2D_WARNING(L"Low memory");
+		return false;
+	}
+
+	short* output = reinterpret_cast<short*>(buffer);
+	for (UINT32 offset = 0; offset + headerSize <= size; offset += blockAlign)
+	{
+		const BYTE* block = data + offset;
+		UINT32 blockSize = min(blockAlign, size - offset);
+		UINT32 groups = (blockSize - headerSize) / (4 * channels);
+
+		for (UINT32 ch = 0; ch < channels; ++ch)
+		{
+			const BYTE* header = block + ch * 4;
+			int predictor = static_cast<short>(ReadU16(header));
+			int index = min(static_cast<int>(header[2]), 88);
+
+			short* out = output + ch;
+			out[0] = static_cast<short>(predictor);
+
+			for (UINT32 g = 0; g < groups; ++g)
+			{
+				const BYTE* src = block + headerSize + (g * channels + ch) * 4;
+				short* dst = out + (1 + g * 8) * channels;
+
+				// ÿֽȵ 4 λ 4 λ
+				for (UINT32 i = 0; i < 4; ++i)
+				{
+					dst[(i * 2) * channels] = DecodeImaNibble(src[i] & 0x0F, predictor, index);
+					dst[(i * 2 + 1) * channels] = DecodeImaNibble(src[i] >> 4, predictor, index);
+				}
+			}
+		}
+		output += (1 + groups * 8) * channels;
+	}
+
+	WAVEFORMATEX pcm = { 0 };
+	pcm.wFormatTag = FORMAT_PCM;
+	pcm.nChannels = format->nChannels;
+	pcm.nSamplesPerSec = format->nSamplesPerSec;
+	pcm.wBitsPerSample = 16;
+	pcm.nBlockAlign = pcm.nChannels * 2;
+	pcm.nAvgBytesPerSec = pcm.nSamplesPerSec * pcm.nBlockAlign;
+
+	_assign(buffer, frames * channels * 2, &pcm);
+	return true;
+}